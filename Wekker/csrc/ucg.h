@@ -50,6 +50,7 @@
   offset	bytes	description
   0		1		glyph_cnt		number of glyphs
   1		1		bbx_mode	0: proportional, 1: common height, 2: monospace, 3: multiple of 8
+				bit 7 (UCG_FONT_BBX_MODE_EXPANDED): glyphs are stored as run pairs
   2		1		bits_per_0	glyph rle parameter
   3		1		bits_per_1	glyph rle parameter
 
@@ -143,10 +144,13 @@ typedef struct _ucg_ccs_t ucg_ccs_t;
 typedef struct _ucg_pixel_t ucg_pixel_t;
 typedef struct _ucg_arg_t ucg_arg_t;
 typedef struct _ucg_com_info_t ucg_com_info_t;
+typedef struct _ucg_strip_t ucg_strip_t;
+typedef struct _ucg_cmd_seq_fast_t ucg_cmd_seq_fast_t;
 
 typedef ucg_int_t (*ucg_dev_fnptr)(ucg_t *ucg, ucg_int_t msg, void *data); 
 typedef int16_t (*ucg_com_fnptr)(ucg_t *ucg, int16_t msg, uint16_t arg, uint8_t *data); 
 typedef ucg_int_t (*ucg_font_calc_vref_fnptr)(ucg_t *ucg);
+typedef int8_t (*ucg_font_decode_glyph_fnptr)(ucg_t *ucg, const uint8_t *glyph_data);
 //typedef ucg_int_t (*ucg_font_mode_fnptr)(ucg_t *ucg, ucg_int_t x, ucg_int_t y, uint8_t dir, uint8_t encoding);
 
 
@@ -236,9 +240,30 @@ struct _ucg_box_t
   ucg_wh_t size;
 };
 
+/*
+  UCG_COLOR_565: Each color also keeps the 16 bit RGB565 value for 
+  devices in 16 bit mode (ST7735). The value is calculated once by 
+  ucg_SetColor() and copied together with the color.
+*/
+#ifndef UCG_COLOR_565
+#define UCG_COLOR_565 1
+#endif
+
+/*
+  UCG_CMD_SEQ_FAST: Drivers register native emitters for their hot command 
+  sequences (set position), see ucg_cmd_seq_fast_t. 0: always interpret 
+  the sequences.
+*/
+#ifndef UCG_CMD_SEQ_FAST
+#define UCG_CMD_SEQ_FAST 1
+#endif
+
 struct _ucg_color_t
 {
   uint8_t color[3];		/* 0: Red, 1: Green, 2: Blue */
+#if UCG_COLOR_565
+  uint8_t rgb565[2];		/* RRRRRGGG GGGBBBBB, calculated by ucg_color_Set565() */
+#endif
 };
 
 struct _ucg_ccs_t
@@ -267,6 +292,7 @@ struct _ucg_arg_t
   ucg_int_t dir;
   ucg_int_t offset;			/* calculated offset from the inital point to the start of the clip window (ucg_clip_l90fx) */
   ucg_int_t scale;			/* upscale factor, used by UCG_MSG_DRAW_L90BF */
+  ucg_int_t lines;			/* number of lines of a window, used by UCG_MSG_WIN_OPEN */
   const unsigned char *bitmap;
   ucg_int_t pixel_skip;		/* within the "bitmap" skip the specified number of pixel with the bit. pixel_skip is always <= 7 */
   ucg_color_t rgb[4];			/* start and end color for L90SE , two more colors for the gradient box */
@@ -317,6 +343,43 @@ struct _ucg_font_info_t
 };
 typedef struct _ucg_font_info_t ucg_font_info_t;
 
+/*
+  State of the strip device (ucg_strip.c). The strip is a RAM buffer with 
+  "h" lines of the (rotated) display. All drawing between ucg_FirstStrip() 
+  and the last ucg_NextStrip() goes to this buffer, each strip is sent to 
+  the display with one window.
+*/
+struct _ucg_strip_t
+{
+  uint16_t *buf;			/* w*h pixel, RGB565 */
+  ucg_int_t w;				/* width of the strip, width of the display */
+  ucg_int_t h;				/* max number of lines of the strip */
+  ucg_int_t y;				/* first line of the current strip */
+  ucg_int_t lines;			/* number of lines of the current strip */
+  uint8_t is_active;			/* 0: strip is not used, all messages go to the display */
+  ucg_box_t user_clip_box;	/* clip box of the user, not rotated */
+  ucg_box_t clip_box;		/* user_clip_box intersected with the current strip */
+  
+  /* window, which has been opened with UCG_MSG_WIN_OPEN */
+  ucg_xy_t win_pos;
+  ucg_int_t win_len;
+  uint8_t win_dir;
+  ucg_int_t win_x;			/* position inside the window */
+  ucg_int_t win_y;
+};
+
+/*
+  Native emitter for a command sequence. ucg_com_SendCmdSeq() calls "fn" 
+  instead of interpreting "seq". The emitter must send the same bytes as 
+  the sequence. A driver registers a table, which ends with seq == NULL, 
+  in ucg->cmd_seq_fast.
+*/
+struct _ucg_cmd_seq_fast_t
+{
+  const ucg_pgm_uint8_t *seq;
+  void (*fn)(ucg_t *ucg);
+};
+
 struct _ucg_font_decode_t
 {
   const uint8_t *decode_ptr;			/* pointer to the compressed data */
@@ -332,6 +395,9 @@ struct _ucg_font_decode_t
   uint8_t decode_bit_pos;			/* bitpos inside a byte of the compressed data */
   uint8_t is_transparent;
   uint8_t dir;				/* direction */
+  
+  uint8_t is_win;				/* glyph is sent into a window (UCG_MSG_WIN_OPEN) */
+  uint16_t win_rem;			/* remaining pixel of the window */
 };
 typedef struct _ucg_font_decode_t ucg_font_decode_t;
 
@@ -377,6 +443,10 @@ struct _ucg_t
   /* if rotation is applied, than this cb is called by the scale device */
   ucg_dev_fnptr scale_chain_device_cb;
   
+  /* if a strip buffer is used, than this cb is called by the strip device */
+  ucg_dev_fnptr strip_chain_device_cb;
+  ucg_strip_t *strip;
+  
   /* communication interface */
   ucg_com_fnptr com_cb;
   
@@ -391,15 +461,19 @@ struct _ucg_t
   /* should be modified via UCG_MSG_SET_CLIP_BOX by a device callback. */
   /* by default this is done by ucg_dev_default_cb */
   ucg_box_t clip_box;
+  /* clip box as set by ucg_SetClipBox(), not rotated, used by ucg_DrawLine() */
+  ucg_box_t user_clip_box;
   
 
   /* information about the current font */
   const unsigned char *font;             /* current font for all text procedures */
   ucg_font_calc_vref_fnptr font_calc_vref;
+  ucg_font_decode_glyph_fnptr font_decode_glyph;	/* decoder for the glyph format, set by ucg_SetFont() */
   //ucg_font_mode_fnptr font_mode;		/* OBSOLETE?? UCG_FONT_MODE_TRANSPARENT, UCG_FONT_MODE_SOLID, UCG_FONT_MODE_NONE */
 
   ucg_font_decode_t font_decode;		/* new font decode structure */
   ucg_font_info_t font_info;			/* new font info structure */
+  uint16_t *font_glyph_index;		/* optional encoding to glyph offset table, see ucg_SetFontGlyphIndex() */
 
   int8_t glyph_dx;			/* OBSOLETE */
   int8_t glyph_x;			/* OBSOLETE */
@@ -428,11 +502,22 @@ struct _ucg_t
     not required, but should be usefull for all uC projects.
   */
   uint8_t com_initial_change_sent;	/* Bit 0: CD/A0 Line Status, Bit 1: CS Line Status, Bit 2: Reset Line Status */
-  uint8_t com_status;		/* Bit 0: CD/A0 Line Status, Bit 1: CS Line Status, Bit 2: Reset Line Status,  Bit 3: 1 for power up */
+  uint8_t com_status;		/* Bit 0: CD/A0 Line Status, Bit 1: CS Line Status, Bit 2: Reset Line Status,  Bit 3: 1 for power up, Bit 4: batch */
   uint8_t com_cfg_cd;		/* Bit 0: Argument Level, Bit 1: Command Level */
+  
+  /* native emitters for command sequences, see ucg_com_SendCmdSeq() */
+  const ucg_cmd_seq_fast_t *cmd_seq_fast;
+  
+  /* resumable command sequences, see ucg_InitAsync() and ucg_com_ResumeCmdSeq() */
+  uint8_t cmd_seq_async;	/* 1: UCG_DLY_MS suspends the sequence instead of waiting */
+  uint16_t cmd_seq_delay;	/* milliseconds to wait before the suspended sequence is resumed */
+  const ucg_pgm_uint8_t *cmd_seq_resume;	/* rest of the suspended sequence, NULL if there is none */
+  
+  /* rotation of the controller (UCG_MSG_SET_HW_ROTATE), 0: not rotated */
+  uint8_t hw_rotate;
 
 #ifdef __AVR_XMEGA__  
-  void  *xmega_hook;   //!< added pointer for print hook, it points to a struct for x, y and direction
+  void  *xmega_hook;   //!< added pointer for the Xmega HAL, it points to the connection and print state of the display, set by ucg_SetXmegaDisplay() before ucg_Init()
 #endif
 };
 
@@ -442,19 +527,44 @@ struct _ucg_t
 #define UCG_MSG_DEV_POWER_UP	10
 #define UCG_MSG_DEV_POWER_DOWN 11
 #define UCG_MSG_SET_CLIP_BOX 12
+/* 
+  rotate the display with the controller, data points to the rotation (uint8_t, 0..3: 0, 90, 180, 270 degree).
+  The device swaps the dimension for 90 and 270 degree. Returns 0 if not supported, see ucg_SetHwRotate().
+*/
+#define UCG_MSG_SET_HW_ROTATE 13
 #define UCG_MSG_GET_DIMENSION 15
 
 /* draw pixel with color from idx 0 */
 #define UCG_MSG_DRAW_PIXEL 20
 #define UCG_MSG_DRAW_L90FX 21
 /* draw  bit pattern, transparent and draw color (idx 0) color */
-//#define UCG_MSG_DRAW_L90TC 22		/* can be commented, used by ucg_DrawTransparentBitmapLine */
+#define UCG_MSG_DRAW_L90TC 22		/* can be commented, used by ucg_DrawTransparentBitmapLine */
 #define UCG_MSG_DRAW_L90SE 23		/* this part of the extension */
 //#define UCG_MSG_DRAW_L90RL 24	/* not yet implemented */
 /* draw  bit pattern with foreground (idx 1) and background (idx 0) color */
-//#define UCG_MSG_DRAW_L90BF 25	 /* can be commented, used by ucg_DrawBitmapLine */
+#define UCG_MSG_DRAW_L90BF 25	 /* can be commented, used by ucg_DrawBitmapLine */
 
+/* 
+  window: a block of "lines" lines with "len" pixel each. The first pixel is at pixel.pos,
+  the pixel of a line follow in direction "dir", the lines follow in direction "dir+1".
+  UCG_MSG_WIN_OPEN returns 0 if the device can not open the window (not supported or
+  the window is not completely inside the clip box). In this case, the caller has 
+  to use the other messages.
+*/
+#define UCG_MSG_WIN_OPEN 26
+/* fill the next "len" pixel of the open window with pixel.rgb */
+#define UCG_MSG_WIN_RUN 27
+#define UCG_MSG_WIN_CLOSE 28
+/* 
+  fill a window (pixel.pos, len, lines, dir, see above) with pixel.rgb. The device 
+  clips the window itself. Returns 0 if not supported, the caller has to draw 
+  the lines with UCG_MSG_DRAW_L90FX in this case.
+*/
+#define UCG_MSG_DRAW_BOX 29
 
+
+/* the CS line stays low until ucg_com_EndBatch(), see ucg_com_BeginBatch() */
+#define UCG_COM_STATUS_MASK_BATCH 16
 #define UCG_COM_STATUS_MASK_POWER 8
 #define UCG_COM_STATUS_MASK_RESET 4
 #define UCG_COM_STATUS_MASK_CS 2
@@ -525,9 +635,14 @@ struct _ucg_t
 	cd_info data cd_info data cd_info data cd_info data ... cd_info data cd_info data
 	cd_info is the level, which is directly applied to the CD line. This means,
 	information applied to UCG_CFG_CD is not relevant.
+	cd_info 0 keeps the level, 1 sets CD low (command), every other value sets 
+	CD high (data): use UCG_COM_CD_SEQ_LEVEL() to decode it.
 */
 #define UCG_COM_MSG_SEND_CD_DATA_SEQUENCE 21
 
+/* level of the CD line after cd_info, "level" is the current level of the CD line */
+#define UCG_COM_CD_SEQ_LEVEL(cd_info, level) ((cd_info) == 0 ? (level) : ((cd_info) == 1 ? 0 : 1))
+
 
 
 /*================================================*/
@@ -566,11 +681,13 @@ void ucg_DrawL90FXWithArg(ucg_t *ucg);
 void ucg_DrawL90TCWithArg(ucg_t *ucg);
 void ucg_DrawL90BFWithArg(ucg_t *ucg);
 void ucg_DrawL90SEWithArg(ucg_t *ucg);
+ucg_int_t ucg_DrawBoxWithArg(ucg_t *ucg);
 /* void ucg_DrawL90RLWithArg(ucg_t *ucg); */
 
 /*================================================*/
 /* ucg_init.c */
 ucg_int_t ucg_Init(ucg_t *ucg, ucg_dev_fnptr device_cb, ucg_dev_fnptr ext_cb, ucg_com_fnptr com_cb);
+ucg_int_t ucg_InitAsync(ucg_t *ucg, ucg_dev_fnptr device_cb, ucg_dev_fnptr ext_cb, ucg_com_fnptr com_cb);
 
 
 /*================================================*/
@@ -581,6 +698,9 @@ ucg_int_t ucg_sdl_dev_cb(ucg_t *ucg, ucg_int_t msg, void *data);
 /* ucg_pixel.c */
 void ucg_SetColor(ucg_t *ucg, uint8_t idx, uint8_t r, uint8_t g, uint8_t b);
 void ucg_DrawPixel(ucg_t *ucg, ucg_int_t x, ucg_int_t y);
+#if UCG_COLOR_565
+void ucg_color_Set565(ucg_color_t *c);
+#endif
 
 /*================================================*/
 /* ucg_line.c */
@@ -601,6 +721,14 @@ void ucg_DrawRBox(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t w, ucg_int_t h
 void ucg_DrawGradientBox(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t w, ucg_int_t h);
 void ucg_DrawFrame(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t w, ucg_int_t h);
 void ucg_DrawRFrame(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t w, ucg_int_t h, ucg_int_t r);
+/* 
+  spans (horizontal lines) of filled shapes, top to bottom: spans with the 
+  same x and width in following lines are merged into one box. span->size.h is 0 
+  if there is no pending span.
+*/
+void ucg_span_init(ucg_t *ucg, ucg_box_t *span);
+void ucg_span_add(ucg_t *ucg, ucg_box_t *span, ucg_int_t x, ucg_int_t y, ucg_int_t w);
+void ucg_span_flush(ucg_t *ucg, ucg_box_t *span);
 
 
 /*================================================*/
@@ -612,6 +740,9 @@ void ucg_DrawRFrame(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t w, ucg_int_t
 #define UCG_DRAW_ALL (UCG_DRAW_UPPER_RIGHT|UCG_DRAW_UPPER_LEFT|UCG_DRAW_LOWER_RIGHT|UCG_DRAW_LOWER_LEFT)
 void ucg_DrawDisc(ucg_t *ucg, ucg_int_t x0, ucg_int_t y0, ucg_int_t rad, uint8_t option);
 void ucg_DrawCircle(ucg_t *ucg, ucg_int_t x0, ucg_int_t y0, ucg_int_t rad, uint8_t option);
+/* discs up to this radius are drawn with one span per line, the table for the rows is on the stack */
+#define UCG_DISC_ROWS_MAX_RAD 63
+void ucg_disc_rows(uint8_t *h, ucg_int_t rad);
 
 /*================================================*/
 /* ucg_bitmap.c */
@@ -626,12 +757,21 @@ void ucg_UndoRotate(ucg_t *ucg);
 void ucg_SetRotate90(ucg_t *ucg);
 void ucg_SetRotate180(ucg_t *ucg);
 void ucg_SetRotate270(ucg_t *ucg);
+void ucg_SetHwRotate(ucg_t *ucg, uint8_t rotation);
 
 /*================================================*/
 /* ucg_scale.c */
 void ucg_UndoScale(ucg_t *ucg);
 void ucg_SetScale2x2(ucg_t *ucg);
 
+/*================================================*/
+/* ucg_strip.c */
+ucg_int_t ucg_dev_strip(ucg_t *ucg, ucg_int_t msg, void *data);
+void ucg_UndoStrip(ucg_t *ucg);
+void ucg_SetStrip(ucg_t *ucg, ucg_strip_t *strip, uint16_t *buf, ucg_int_t h);
+void ucg_FirstStrip(ucg_t *ucg);
+uint8_t ucg_NextStrip(ucg_t *ucg);
+
 
 /*================================================*/
 /* ucg_polygon.c */
@@ -682,6 +822,8 @@ struct _pg_struct
   uint8_t is_min_y_not_flat;
   pg_word_t total_scan_line_cnt;
   struct pg_edge_struct pge[2];	/* left and right line draw structures */
+  
+  ucg_box_t span;		/* pending span, see ucg_span_add() */
 };
 
 void pg_ClearPolygonXY(pg_struct *pg);
@@ -754,6 +896,51 @@ void ucg_SetFontPosTop(ucg_t *ucg);
 void ucg_SetFontPosCenter(ucg_t *ucg);
 
 void ucg_SetFont(ucg_t *ucg, const ucg_fntpgm_uint8_t  *font);
+
+/*
+  Glyph format: Fonts with UCG_FONT_BBX_MODE_EXPANDED in the bbx_mode byte 
+  store the glyphs as byte pairs of background and foreground runs instead 
+  of the bit packed run length code (see ucg_font.c). They are larger, but 
+  faster to draw. ucg_SetFont() selects the decoder.
+*/
+#define UCG_FONT_BBX_MODE_EXPANDED 0x80
+int8_t ucg_font_decode_glyph(ucg_t *ucg, const uint8_t *glyph_data);
+int8_t ucg_font_decode_glyph_expanded(ucg_t *ucg, const uint8_t *glyph_data);
+
+/* 
+  Glyph index: table with UCG_FONT_GLYPH_INDEX_SIZE entries, provided by the user.
+  The table is filled by ucg_SetFont() and replaces the linear glyph search 
+  by a single table read. Pass NULL to go back to the linear search.
+*/
+#define UCG_FONT_GLYPH_INDEX_SIZE 256
+void ucg_SetFontGlyphIndex(ucg_t *ucg, uint16_t *glyph_index);
+
+/*
+  Glyph cache: The run lengths of the last decoded glyphs are kept in RAM.
+  UCG_FONT_CACHE_ENTRIES glyphs with up to UCG_FONT_CACHE_RUNS run pairs 
+  each (2 bytes per pair), glyphs with more runs are not cached.
+  RAM usage is about UCG_FONT_CACHE_ENTRIES*(UCG_FONT_CACHE_RUNS*2+10) bytes,
+  2.4 KB for 12 entries. The cache only pays off for run length encoded fonts
+  which are drawn again and again, so it is off by default: define
+  UCG_FONT_CACHE_ENTRIES (e.g. 12) in the project to enable it.
+*/
+#ifndef UCG_FONT_CACHE_ENTRIES
+#define UCG_FONT_CACHE_ENTRIES 0
+#endif
+#ifndef UCG_FONT_CACHE_RUNS
+#define UCG_FONT_CACHE_RUNS 96
+#endif
+
+#if UCG_FONT_CACHE_ENTRIES > 0
+struct _ucg_font_cache_stat_t
+{
+  uint32_t hit;		/* glyph was taken from the cache */
+  uint32_t miss;	/* glyph had to be decoded */
+};
+typedef struct _ucg_font_cache_stat_t ucg_font_cache_stat_t;
+extern ucg_font_cache_stat_t ucg_font_cache_stat;
+void ucg_ClearFontCache(void);
+#endif
 //void ucg_SetFontMode(ucg_t *ucg, ucg_font_mode_fnptr font_mode);
 void ucg_SetFontMode(ucg_t *ucg, uint8_t is_transparent);
 
@@ -769,6 +956,7 @@ ucg_int_t ucg_clip_is_pixel_visible(ucg_t *ucg);
 ucg_int_t ucg_clip_l90fx(ucg_t *ucg);
 ucg_int_t ucg_clip_l90tc(ucg_t *ucg);
 ucg_int_t ucg_clip_l90se(ucg_t *ucg);
+ucg_int_t ucg_clip_win(ucg_t *ucg);
 
 
 /*================================================*/
@@ -882,6 +1070,8 @@ void ucg_com_SetLineStatus(ucg_t *ucg, uint8_t level, uint8_t mask, uint8_t msg)
 void ucg_com_SetResetLineStatus(ucg_t *ucg, uint8_t level);
 void ucg_com_SetCSLineStatus(ucg_t *ucg, uint8_t level);
 void ucg_com_SetCDLineStatus(ucg_t *ucg, uint8_t level);
+uint8_t ucg_com_BeginBatch(ucg_t *ucg);
+void ucg_com_EndBatch(ucg_t *ucg);
 void ucg_com_DelayMicroseconds(ucg_t *ucg, uint16_t delay) UCG_NOINLINE;
 void ucg_com_DelayMilliseconds(ucg_t *ucg, uint16_t delay) UCG_NOINLINE;
 #ifndef ucg_com_SendByte
@@ -895,6 +1085,7 @@ void ucg_com_SendRepeat3Bytes(ucg_t *ucg, uint16_t cnt, uint8_t *byte_ptr);
 void ucg_com_SendString(ucg_t *ucg, uint16_t cnt, const uint8_t *byte_ptr);
 void ucg_com_SendCmdDataSequence(ucg_t *ucg, uint16_t cnt, const uint8_t *byte_ptr, uint8_t cd_line_status_at_end);
 void ucg_com_SendCmdSeq(ucg_t *ucg, const ucg_pgm_uint8_t *data);
+uint8_t ucg_com_ResumeCmdSeq(ucg_t *ucg);
 
 
 /*================================================*/
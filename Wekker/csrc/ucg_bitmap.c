@@ -39,9 +39,7 @@
 #ifdef UCG_MSG_DRAW_L90TC
 void ucg_DrawTransparentBitmapLine(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t dir, ucg_int_t len, const unsigned char *bitmap)
 {
-  ucg->arg.pixel.rgb.color[0] = ucg->arg.rgb[0].color[0];
-  ucg->arg.pixel.rgb.color[1] = ucg->arg.rgb[0].color[1];
-  ucg->arg.pixel.rgb.color[2] = ucg->arg.rgb[0].color[2];
+  ucg->arg.pixel.rgb = ucg->arg.rgb[0];
   ucg->arg.pixel.pos.x = x;
   ucg->arg.pixel.pos.y = y;
   ucg->arg.dir = dir;
@@ -56,9 +54,7 @@ void ucg_DrawTransparentBitmapLine(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int
 void ucg_DrawBitmapLine(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t dir, ucg_int_t len, const unsigned char *bitmap)
 {
   /*
-  ucg->arg.pixel.rgb.color[0] = ucg->arg.rgb[0].color[0];
-  ucg->arg.pixel.rgb.color[1] = ucg->arg.rgb[0].color[1];
-  ucg->arg.pixel.rgb.color[2] = ucg->arg.rgb[0].color[2];
+  ucg->arg.pixel.rgb = ucg->arg.rgb[0];
   */
   ucg->arg.pixel.pos.x = x;
   ucg->arg.pixel.pos.y = y;
@@ -74,9 +70,7 @@ void ucg_DrawBitmapLine(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t dir, ucg
 #ifdef ON_HOLD
 void ucg_DrawRLBitmap(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t dir, const unsigned char *rl_bitmap)
 {
-  ucg->arg.pixel.rgb.color[0] = ucg->arg.rgb[0].color[0];
-  ucg->arg.pixel.rgb.color[1] = ucg->arg.rgb[0].color[1];
-  ucg->arg.pixel.rgb.color[2] = ucg->arg.rgb[0].color[2];
+  ucg->arg.pixel.rgb = ucg->arg.rgb[0];
   ucg->arg.pixel.pos.x = x;
   ucg->arg.pixel.pos.y = y;
   ucg->arg.dir = dir;
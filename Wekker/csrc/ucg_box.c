@@ -37,6 +37,20 @@
 
 void ucg_DrawBox(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t w, ucg_int_t h)
 {
+  if ( w <= 0 || h <= 0 )
+    return;
+  
+  /* try one window for the complete box */
+  ucg->arg.pixel.rgb = ucg->arg.rgb[0];
+  ucg->arg.pixel.pos.x = x;
+  ucg->arg.pixel.pos.y = y;
+  ucg->arg.len = w;
+  ucg->arg.lines = h;
+  ucg->arg.dir = 0;
+  if ( ucg_DrawBoxWithArg(ucg) != 0 )
+    return;
+  
+  /* not supported by the device: draw line by line */
   while( h > 0 )
   {
     ucg_DrawHLine(ucg, x, y, w);
@@ -45,6 +59,55 @@ void ucg_DrawBox(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t w, ucg_int_t h)
   }  
 }
 
+/*================================================*/
+/* spans */
+
+void ucg_span_init(ucg_t *ucg, ucg_box_t *span)
+{
+  span->size.h = 0;
+}
+
+/* draw the pending span */
+void ucg_span_flush(ucg_t *ucg, ucg_box_t *span)
+{
+  if ( span->size.h == 1 )
+    ucg_DrawHLine(ucg, span->ul.x, span->ul.y, span->size.w);
+  else if ( span->size.h > 1 )
+    ucg_DrawBox(ucg, span->ul.x, span->ul.y, span->size.w, span->size.h);
+  span->size.h = 0;
+}
+
+/* 
+  add a span, it is clipped against the user clip box. It extends the pending 
+  span, if it is the next line with the same x and width.
+*/
+void ucg_span_add(ucg_t *ucg, ucg_box_t *span, ucg_int_t x, ucg_int_t y, ucg_int_t w)
+{
+  ucg_int_t x1;
+  
+  if ( y < ucg->user_clip_box.ul.y || y >= ucg->user_clip_box.ul.y + ucg->user_clip_box.size.h )
+    return;
+  x1 = x + w;
+  if ( x < ucg->user_clip_box.ul.x )
+    x = ucg->user_clip_box.ul.x;
+  if ( x1 > ucg->user_clip_box.ul.x + ucg->user_clip_box.size.w )
+    x1 = ucg->user_clip_box.ul.x + ucg->user_clip_box.size.w;
+  w = x1 - x;
+  if ( w <= 0 )
+    return;
+  
+  if ( span->size.h != 0 && span->ul.x == x && span->size.w == w && span->ul.y + span->size.h == y )
+  {
+    span->size.h++;
+    return;
+  }
+  ucg_span_flush(ucg, span);
+  span->ul.x = x;
+  span->ul.y = y;
+  span->size.w = w;
+  span->size.h = 1;
+}
+
 /*
   - clear the screen with black color
   - reset clip range to max
@@ -60,11 +123,50 @@ void ucg_ClearScreen(ucg_t *ucg)
 
 
 
+/*
+  One span per line: the corners have the half width of the lines of a disc 
+  (ucg_disc_rows()), the lines between the corners are merged into one box.
+*/
+static void ucg_draw_rbox_rows(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t w, ucg_int_t h, ucg_int_t r)
+{
+  uint8_t rows[UCG_DISC_ROWS_MAX_RAD+1];
+  ucg_box_t span;
+  ucg_int_t i, d;
+  uint8_t is_batch;
+  
+  ucg_disc_rows(rows, r);
+  ucg_span_init(ucg, &span);
+  is_batch = ucg_com_BeginBatch(ucg);
+  for( i = 0; i < h; i++ )
+  {
+    /* distance to the center line of the corner, 0 for the lines between the corners */
+    d = 0;
+    if ( i < r )
+      d = r - i;
+    else if ( i >= h - r )
+      d = i - (h - r - 1);
+    /* the corner is at x+r, the line starts r-rows[d] pixel right of x */
+    d = r - rows[d];
+    ucg_span_add(ucg, &span, x + d, y + i, w - 2*d);
+  }
+  ucg_span_flush(ucg, &span);
+  if ( is_batch != 0 )
+    ucg_com_EndBatch(ucg);
+}
+
 void ucg_DrawRBox(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t w, ucg_int_t h, ucg_int_t r)
 {
   ucg_int_t xl, yu;
   ucg_int_t yl, xr;
 
+  if ( r >= 0 && r <= UCG_DISC_ROWS_MAX_RAD && w >= 2*r+2 && h >= 2*r+2 )
+  {
+    ucg_draw_rbox_rows(ucg, x, y, w, h, r);
+    return;
+  }
+  
+  /* large radius or the corners overlap */
+
   xl = x;
   xl += r;
   yu = y;
@@ -133,6 +235,10 @@ void ucg_DrawGradientBox(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t w, ucg_
     ucg->arg.rgb[1].color[0] = ucg_ccs_box[3].current;
     ucg->arg.rgb[1].color[1] = ucg_ccs_box[4].current;
     ucg->arg.rgb[1].color[2] = ucg_ccs_box[5].current;
+#if UCG_COLOR_565
+    ucg_color_Set565(ucg->arg.rgb+0);
+    ucg_color_Set565(ucg->arg.rgb+1);
+#endif
     //printf("%d %d %d\n", ucg_ccs_box[0].current, ucg_ccs_box[1].current, ucg_ccs_box[2].current);
     //printf("%d %d %d\n", ucg_ccs_box[3].current, ucg_ccs_box[4].current, ucg_ccs_box[5].current);
     ucg->arg.pixel.pos.x = x;
@@ -194,24 +194,104 @@ void ucg_draw_disc(ucg_t *ucg, ucg_int_t x0, ucg_int_t y0, ucg_int_t rad, uint8_
   }
 }
 
-void ucg_DrawDisc(ucg_t *ucg, ucg_int_t x0, ucg_int_t y0, ucg_int_t rad, uint8_t option)
+/*
+  Half width of the lines of a disc, same pixel as ucg_draw_disc(): 
+  line y0-r and y0+r go from x0-h[r] to x0+h[r], r = 0..rad
+  
+  ucg_draw_disc() draws the vertical line x0+x with y+1 pixel and the line
+  x0+y with x+1 pixel. So line r contains x0+x, if r <= y and x0+y, if r <= x.
+*/
+void ucg_disc_rows(uint8_t *h, ucg_int_t rad)
 {
-  /* check for bounding box */
-  /*
+  ucg_int_t f;
+  ucg_int_t ddF_x;
+  ucg_int_t ddF_y;
+  ucg_int_t x;
+  ucg_int_t y;
+
+  for( x = 0; x <= rad; x++ )
+    h[x] = 0;
+  
+  f = 1;
+  f -= rad;
+  ddF_x = 1;
+  ddF_y = 0;
+  ddF_y -= rad;
+  ddF_y *= 2;
+  x = 0;
+  y = rad;
+
+  for(;;)
   {
-    ucg_int_t radp, radp2;
-    
-    radp = rad;
-    radp++;
-    radp2 = radp;
-    radp2 *= 2;
-    
-    if ( ucg_IsBBXIntersection(ucg, x0-radp, y0-radp, radp2, radp2) == 0)
-      return;    
+    if ( h[x] < y )
+      h[x] = y;
+    if ( h[y] < x )
+      h[y] = x;
+    if ( x >= y )
+      break;
+    if (f >= 0) 
+    {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
   }
-  */
+  
+  /* line r also contains all x0+x of the lines below r */
+  for( x = rad; x > 0; x-- )
+    if ( h[x-1] < h[x] )
+      h[x-1] = h[x];
+}
+
+/* one span per line, the quarters in "option" */
+static void ucg_draw_disc_rows(ucg_t *ucg, ucg_int_t x0, ucg_int_t y0, ucg_int_t rad, uint8_t option)
+{
+  uint8_t rows[UCG_DISC_ROWS_MAX_RAD+1];
+  ucg_box_t span;
+  ucg_int_t r, x1, x2;
+  uint8_t quarter;
+  uint8_t is_batch;
+  
+  ucg_disc_rows(rows, rad);
+  ucg_span_init(ucg, &span);
+  is_batch = ucg_com_BeginBatch(ucg);
+  for( r = -rad; r <= rad; r++ )
+  {
+    if ( r < 0 )
+      quarter = option & (UCG_DRAW_UPPER_LEFT|UCG_DRAW_UPPER_RIGHT);
+    else if ( r > 0 )
+      quarter = option & (UCG_DRAW_LOWER_LEFT|UCG_DRAW_LOWER_RIGHT);
+    else
+      quarter = option;		/* center line belongs to all quarters */
+    x1 = x0;
+    x2 = x0;
+    if ( quarter & (UCG_DRAW_UPPER_LEFT|UCG_DRAW_LOWER_LEFT) )
+      x1 -= rows[r < 0 ? -r : r];
+    if ( quarter & (UCG_DRAW_UPPER_RIGHT|UCG_DRAW_LOWER_RIGHT) )
+      x2 += rows[r < 0 ? -r : r];
+    if ( quarter != 0 )
+      ucg_span_add(ucg, &span, x1, y0 + r, x2 - x1 + 1);
+  }
+  ucg_span_flush(ucg, &span);
+  if ( is_batch != 0 )
+    ucg_com_EndBatch(ucg);
+}
+
+void ucg_DrawDisc(ucg_t *ucg, ucg_int_t x0, ucg_int_t y0, ucg_int_t rad, uint8_t option)
+{
+  /* check for bounding box */
+  if ( x0 + rad < ucg->user_clip_box.ul.x || x0 - rad >= ucg->user_clip_box.ul.x + ucg->user_clip_box.size.w )
+    return;
+  if ( y0 + rad < ucg->user_clip_box.ul.y || y0 - rad >= ucg->user_clip_box.ul.y + ucg->user_clip_box.size.h )
+    return;
   
   /* draw disc */
-  ucg_draw_disc(ucg, x0, y0, rad, option);
+  if ( rad >= 0 && rad <= UCG_DISC_ROWS_MAX_RAD )
+    ucg_draw_disc_rows(ucg, x0, y0, rad, option);
+  else
+    ucg_draw_disc(ucg, x0, y0, rad, option);
 }
 
@@ -250,3 +250,73 @@ ucg_int_t ucg_clip_l90se(ucg_t *ucg)
   return 1;
 }
 
+/*
+  assumes, that ucg->arg contains a window (pixel.pos, len, lines, dir) and 
+  does clipping against ucg->clip_box. The clipped window keeps its direction.
+*/
+ucg_int_t ucg_clip_win(ucg_t *ucg)
+{
+  ucg_int_t x0, y0, x1, y1;	/* x1 and y1 are excluded */
+  
+  x0 = ucg->arg.pixel.pos.x;
+  y0 = ucg->arg.pixel.pos.y;
+  switch(ucg->arg.dir)
+  {
+    case 0:
+      x1 = x0 + ucg->arg.len;
+      y1 = y0 + ucg->arg.lines;
+      break;
+    case 1:
+      x1 = x0 + 1;
+      x0 = x1 - ucg->arg.lines;
+      y1 = y0 + ucg->arg.len;
+      break;
+    case 2:
+      x1 = x0 + 1;
+      x0 = x1 - ucg->arg.len;
+      y1 = y0 + 1;
+      y0 = y1 - ucg->arg.lines;
+      break;
+    case 3:
+    default:
+      x1 = x0 + ucg->arg.lines;
+      y1 = y0 + 1;
+      y0 = y1 - ucg->arg.len;
+      break;
+  }
+  
+  if ( ucg_clip_intersection(&x0, &x1, ucg->clip_box.ul.x, ucg->clip_box.ul.x+ucg->clip_box.size.w) == 0 )
+    return 0;
+  if ( ucg_clip_intersection(&y0, &y1, ucg->clip_box.ul.y, ucg->clip_box.ul.y+ucg->clip_box.size.h) == 0 )
+    return 0;
+  
+  switch(ucg->arg.dir)
+  {
+    case 0:
+      ucg->arg.pixel.pos.x = x0;
+      ucg->arg.pixel.pos.y = y0;
+      ucg->arg.len = x1 - x0;
+      ucg->arg.lines = y1 - y0;
+      break;
+    case 1:
+      ucg->arg.pixel.pos.x = x1 - 1;
+      ucg->arg.pixel.pos.y = y0;
+      ucg->arg.len = y1 - y0;
+      ucg->arg.lines = x1 - x0;
+      break;
+    case 2:
+      ucg->arg.pixel.pos.x = x1 - 1;
+      ucg->arg.pixel.pos.y = y1 - 1;
+      ucg->arg.len = x1 - x0;
+      ucg->arg.lines = y1 - y0;
+      break;
+    case 3:
+    default:
+      ucg->arg.pixel.pos.x = x0;
+      ucg->arg.pixel.pos.y = y1 - 1;
+      ucg->arg.len = y1 - y0;
+      ucg->arg.lines = x1 - x0;
+      break;
+  }
+  return 1;
+}
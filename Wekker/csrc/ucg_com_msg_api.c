@@ -124,9 +124,33 @@ void ucg_com_SetResetLineStatus(ucg_t *ucg, uint8_t level)
 
 void ucg_com_SetCSLineStatus(ucg_t *ucg, uint8_t level)
 {
+  if ( level != 0 && (ucg->com_status & UCG_COM_STATUS_MASK_BATCH) != 0 )
+    return;	/* keep the chip enabled until ucg_com_EndBatch() */
   ucg_com_SetLineStatus(ucg, level, UCG_COM_STATUS_MASK_CS, UCG_COM_MSG_CHANGE_CS_LINE);
 }
 
+/*
+  Batch: all drawing procedures until ucg_com_EndBatch() are one transaction,
+  the chip is not disabled between them. This requires a controller, which
+  does not need a CS change between the commands (e.g. ST7735).
+  Returns 0, if a batch is already started, ucg_com_EndBatch() must
+  be called only if ucg_com_BeginBatch() has returned 1.
+*/
+uint8_t ucg_com_BeginBatch(ucg_t *ucg)
+{
+  if ( (ucg->com_status & UCG_COM_STATUS_MASK_BATCH) != 0 )
+    return 0;
+  ucg->com_status |= UCG_COM_STATUS_MASK_BATCH;
+  return 1;
+}
+
+void ucg_com_EndBatch(ucg_t *ucg)
+{
+  ucg->com_status &= ~UCG_COM_STATUS_MASK_BATCH;
+  if ( (ucg->com_initial_change_sent & UCG_COM_STATUS_MASK_CS) != 0 )
+    ucg_com_SetCSLineStatus(ucg, 1);		/* disable chip */
+}
+
 void ucg_com_SetCDLineStatus(ucg_t *ucg, uint8_t level)
 {
   ucg_com_SetLineStatus(ucg, level, UCG_COM_STATUS_MASK_CD, UCG_COM_MSG_CHANGE_CD_LINE);
@@ -196,6 +220,8 @@ void ucg_com_SendStringP(ucg_t *ucg, uint16_t cnt, const ucg_pgm_uint8_t *byte_p
 void ucg_com_SendCmdDataSequence(ucg_t *ucg, uint16_t cnt, const uint8_t *byte_ptr, uint8_t cd_line_status_at_end)
 {
   ucg->com_cb(ucg, UCG_COM_MSG_SEND_CD_DATA_SEQUENCE, cnt, (uint8_t *)byte_ptr);
+  /* the sequence has changed the CD line, com_status does not know the level: force the change */
+  ucg->com_initial_change_sent &= ~UCG_COM_STATUS_MASK_CD;
   ucg_com_SetCDLineStatus(ucg, cd_line_status_at_end);	// ensure that the status is set correctly for the CD line */
 }
 
@@ -315,6 +341,21 @@ void ucg_com_SendCmdSeq(ucg_t *ucg, const ucg_pgm_uint8_t *data)
   uint8_t bb;
   uint8_t hi;
   uint8_t lo;
+  const ucg_cmd_seq_fast_t *fast;
+
+  /* use the native emitter of the driver, if there is one for this sequence */
+  fast = ucg->cmd_seq_fast;
+  if ( fast != NULL )
+  {
+    for( ; fast->seq != NULL; fast++ )
+    {
+      if ( fast->seq == data )
+      {
+	fast->fn(ucg);
+	return;
+      }
+    }
+  }
 
   for(;;)
   {
@@ -347,8 +388,15 @@ void ucg_com_SendCmdSeq(ucg_t *ucg, const ucg_pgm_uint8_t *data)
 	data++;
 	b = ucg_pgm_read(data);
 	//b = *data;
-	ucg_com_DelayMilliseconds(ucg, (((uint16_t)lo)<<8) + b );
 	data++;
+	if ( ucg->cmd_seq_async != 0 )
+	{
+	  /* suspend, ucg_com_ResumeCmdSeq() continues after the delay */
+	  ucg->cmd_seq_delay = (((uint16_t)lo)<<8) + b;
+	  ucg->cmd_seq_resume = data;
+	  return;
+	}
+	ucg_com_DelayMilliseconds(ucg, (((uint16_t)lo)<<8) + b );
 	break;
       case 9:
 	data++;
@@ -404,3 +452,21 @@ void ucg_com_SendCmdSeq(ucg_t *ucg, const ucg_pgm_uint8_t *data)
   }
 }
 
+/*
+  Continue a command sequence that has been suspended by UCG_DLY_MS(),
+  see ucg_InitAsync(). The caller has waited ucg->cmd_seq_delay milliseconds.
+  Returns 1 if the sequence has been suspended again, 0 if it is complete.
+*/
+uint8_t ucg_com_ResumeCmdSeq(ucg_t *ucg)
+{
+  const ucg_pgm_uint8_t *data = ucg->cmd_seq_resume;
+  
+  if ( data == NULL )
+    return 0;
+  ucg->cmd_seq_resume = NULL;
+  ucg_com_SendCmdSeq(ucg, data);
+  if ( ucg->cmd_seq_resume != NULL )
+    return 1;
+  ucg->cmd_seq_async = 0;
+  return 0;
+}
@@ -50,6 +50,12 @@ ucg_int_t ucg_dev_default_cb(ucg_t *ucg, ucg_int_t msg, void *data)
     case UCG_MSG_SET_CLIP_BOX:
       ucg->clip_box = *(ucg_box_t *)data;
       break;
+    case UCG_MSG_WIN_OPEN:
+      return 0;	/* windows are not supported by default, caller has to use the l90 messages */
+    case UCG_MSG_DRAW_BOX:
+      return 0;	/* same for boxes, caller draws the lines */
+    case UCG_MSG_SET_HW_ROTATE:
+      return 0;	/* no rotation by the controller, ucg_SetHwRotate() uses the rotation callbacks */
   }
   return 1;	/* all ok */
 }
@@ -231,6 +237,9 @@ ucg_int_t ucg_handle_l90se(ucg_t *ucg, ucg_dev_fnptr dev_cb)
       ucg->arg.pixel.rgb.color[0] = ucg->arg.ccs_line[0].current;
       ucg->arg.pixel.rgb.color[1] = ucg->arg.ccs_line[1].current; 
       ucg->arg.pixel.rgb.color[2] = ucg->arg.ccs_line[2].current;
+#if UCG_COLOR_565
+      ucg_color_Set565(&(ucg->arg.pixel.rgb));
+#endif
       dev_cb(ucg, UCG_MSG_DRAW_PIXEL, NULL);
       ucg->arg.pixel.pos.x+=dx;
       ucg->arg.pixel.pos.y+=dy;
@@ -120,38 +120,40 @@ const ucg_pgm_uint8_t ucg_ili9341_set_pos_dir3_seq[] =
   UCG_END()
 };
 
-ucg_int_t ucg_handle_ili9341_l90fx(ucg_t *ucg)
+/* enable chip, set the position and the direction of the line in ucg->arg and start "write to RAM" */
+static void ucg_ili9341_set_pos_dir(ucg_t *ucg)
 {
-  uint8_t c[3];
   ucg_int_t tmp;
-  if ( ucg_clip_l90fx(ucg) != 0 )
+  switch(ucg->arg.dir)
   {
-    switch(ucg->arg.dir)
-    {
-      case 0: 
+    case 0: 
 	ucg_com_SendCmdSeq(ucg, ucg_ili9341_set_pos_dir0_seq);	
 	break;
-      case 1: 
+    case 1: 
 	ucg_com_SendCmdSeq(ucg, ucg_ili9341_set_pos_dir1_seq);	
 	break;
-      case 2: 
+    case 2: 
 	tmp = ucg->arg.pixel.pos.x;
 	ucg->arg.pixel.pos.x = 239-tmp;
 	ucg_com_SendCmdSeq(ucg, ucg_ili9341_set_pos_dir2_seq);	
 	ucg->arg.pixel.pos.x = tmp;
 	break;
-      case 3: 
-      default: 
+    case 3: 
+    default: 
 	tmp = ucg->arg.pixel.pos.y;
 	ucg->arg.pixel.pos.y = 319-tmp;
 	ucg_com_SendCmdSeq(ucg, ucg_ili9341_set_pos_dir3_seq);	
 	ucg->arg.pixel.pos.y = tmp;
 	break;
-    }
-    c[0] = ucg->arg.pixel.rgb.color[0];
-    c[1] = ucg->arg.pixel.rgb.color[1];
-    c[2] = ucg->arg.pixel.rgb.color[2];
-    ucg_com_SendRepeat3Bytes(ucg, ucg->arg.len, c);
+  }
+}
+
+ucg_int_t ucg_handle_ili9341_l90fx(ucg_t *ucg)
+{
+  if ( ucg_clip_l90fx(ucg) != 0 )
+  {
+    ucg_ili9341_set_pos_dir(ucg);
+    ucg_com_SendRepeat3Bytes(ucg, ucg->arg.len, ucg->arg.pixel.rgb.color);
     ucg_com_SetCSLineStatus(ucg, 1);		/* disable chip */
     return 1;
   }
@@ -159,92 +161,101 @@ ucg_int_t ucg_handle_ili9341_l90fx(ucg_t *ucg)
 }
 
 /*
-  L2TC (Glyph Output)
+  L90TC (transparent bitmap line) and L90BF (bitmap line with foreground and background)
   
+  The bits of the bitmap are sent as runs of the same color. L90BF sets the position 
+  once for the complete line, L90TC once for each run of set bits.
 */
 
-/* with CmdDataSequence */ 
 ucg_int_t ucg_handle_ili9341_l90tc(ucg_t *ucg)
 {
   if ( ucg_clip_l90tc(ucg) != 0 )
   {
-    uint8_t buf[16];
     ucg_int_t dx, dy;
-    ucg_int_t i;
+    ucg_int_t i, cnt;
+    ucg_xy_t pos;
     unsigned char pixmap;
     uint8_t bitcnt;
-    ucg_com_SetCSLineStatus(ucg, 0);		/* enable chip */
-    ucg_com_SendCmdSeq(ucg, ucg_ili9341_set_pos_seq);	
-
-    buf[0] = 0x001;	// change to 0 (cmd mode)
-    buf[1] = 0x02a;	// set x
-    buf[2] = 0x002;	// change to 1 (arg mode)
-    buf[3] = 0x000;	// upper part x
-    buf[4] = 0x000;	// no change
-    buf[5] = 0x000;	// will be overwritten by x value
-    buf[6] = 0x001;	// change to 0 (cmd mode)
-    buf[7] = 0x02c;	// write data
-    buf[8] = 0x002;	// change to 1 (data mode)
-    buf[9] = 0x000;	// red value
-    buf[10] = 0x000;	// no change
-    buf[11] = 0x000;	// green value
-    buf[12] = 0x000;	// no change
-    buf[13] = 0x000;	// blue value      
-    
     switch(ucg->arg.dir)
     {
-      case 0: 
-	dx = 1; dy = 0; 
-	buf[1] = 0x02a;	// set x
-	break;
-      case 1: 	
-	dx = 0; dy = 1; 
-        buf[1] = 0x02b;	// set y
-	break;
-      case 2: 
-	dx = -1; dy = 0; 
-        buf[1] = 0x02a;	// set x
-	break;
+      case 0: dx = 1; dy = 0; break;
+      case 1: dx = 0; dy = 1; break;
+      case 2: dx = -1; dy = 0; break;
       case 3: 
-      default:
-	dx = 0; dy = -1; 
-        buf[1] = 0x02b;	// set y
-	break;
+      default: dx = 0; dy = -1; break;
     }
     pixmap = ucg_pgm_read(ucg->arg.bitmap);
     bitcnt = ucg->arg.pixel_skip;
     pixmap <<= bitcnt;
-    buf[9] = ucg->arg.pixel.rgb.color[0];
-    buf[11] = ucg->arg.pixel.rgb.color[1];
-    buf[13] = ucg->arg.pixel.rgb.color[2];
-    //ucg_com_SetCSLineStatus(ucg, 0);		/* enable chip */
-    
+    pos = ucg->arg.pixel.pos;
+    cnt = 0;
+    for( i = 0; i <= ucg->arg.len; i++ )
+    {
+      if ( i < ucg->arg.len && (pixmap & 128) != 0 )
+      {
+	cnt++;
+      }
+      else if ( cnt > 0 )
+      {
+	/* end of a run: the run starts cnt pixel before the current position */
+	ucg->arg.pixel.pos.x = pos.x - cnt*dx;
+	ucg->arg.pixel.pos.y = pos.y - cnt*dy;
+	ucg_ili9341_set_pos_dir(ucg);
+	ucg_com_SendRepeat3Bytes(ucg, cnt, ucg->arg.pixel.rgb.color);
+	cnt = 0;
+      }
+      pixmap<<=1;
+      pos.x+=dx;
+      pos.y+=dy;
+      bitcnt++;
+      if ( bitcnt >= 8 && i+1 < ucg->arg.len )
+      {
+	ucg->arg.bitmap++;
+	pixmap = ucg_pgm_read(ucg->arg.bitmap);
+	bitcnt = 0;
+      }
+    }
+    ucg_com_SetCSLineStatus(ucg, 1);		/* disable chip */
+    return 1;
+  }
+  return 0;
+}
+
+ucg_int_t ucg_handle_ili9341_l90bf(ucg_t *ucg)
+{
+  if ( ucg->arg.scale != 1 )
+    return ucg_handle_l90bf(ucg, ucg_dev_ic_ili9341_18);	/* upscaled bitmaps are drawn pixel by pixel */
+  if ( ucg_clip_l90tc(ucg) != 0 )
+  {
+    ucg_int_t i, cnt;
+    unsigned char pixmap;
+    uint8_t bitcnt, bit;
+    ucg_ili9341_set_pos_dir(ucg);
+    pixmap = ucg_pgm_read(ucg->arg.bitmap);
+    bitcnt = ucg->arg.pixel_skip;
+    pixmap <<= bitcnt;
+    bit = pixmap & 128;
+    cnt = 0;
     for( i = 0; i < ucg->arg.len; i++ )
     {
-      if ( (pixmap & 128) != 0 )
+      if ( (pixmap & 128) != bit )
       {
-	if ( (ucg->arg.dir&1) == 0 )
-	{
-	  buf[5] = ucg->arg.pixel.pos.x;
-	}
-	else
-	{
-	  buf[3] = ucg->arg.pixel.pos.y>>8;
-	  buf[5] = ucg->arg.pixel.pos.y&255;
-	}
-	ucg_com_SendCmdDataSequence(ucg, 7, buf, 0);
+	/* set bits use color 0, cleared bits color 1, like ucg_handle_l90bf() */
+	ucg_com_SendRepeat3Bytes(ucg, cnt, ucg->arg.rgb[bit != 0 ? 0 : 1].color);
+	bit = pixmap & 128;
+	cnt = 0;
       }
+      cnt++;
       pixmap<<=1;
-      ucg->arg.pixel.pos.x+=dx;
-      ucg->arg.pixel.pos.y+=dy;
       bitcnt++;
-      if ( bitcnt >= 8 )
+      if ( bitcnt >= 8 && i+1 < ucg->arg.len )
       {
 	ucg->arg.bitmap++;
 	pixmap = ucg_pgm_read(ucg->arg.bitmap);
 	bitcnt = 0;
       }
     }
+    ucg_com_SendRepeat3Bytes(ucg, cnt, ucg->arg.rgb[bit != 0 ? 0 : 1].color);
     ucg_com_SetCSLineStatus(ucg, 1);		/* disable chip */
     return 1;
   }
@@ -256,7 +267,6 @@ ucg_int_t ucg_handle_ili9341_l90se(ucg_t *ucg)
 {
   uint8_t i;
   uint8_t c[3];
-  ucg_int_t tmp;
   
   /* Setup ccs for l90se. This will be updated by ucg_clip_l90se if required */
   
@@ -270,28 +280,7 @@ ucg_int_t ucg_handle_ili9341_l90se(ucg_t *ucg)
   if ( ucg_clip_l90se(ucg) != 0 )
   {
     ucg_int_t i;
-    switch(ucg->arg.dir)
-    {
-      case 0: 
-	ucg_com_SendCmdSeq(ucg, ucg_ili9341_set_pos_dir0_seq);	
-	break;
-      case 1: 
-	ucg_com_SendCmdSeq(ucg, ucg_ili9341_set_pos_dir1_seq);	
-	break;
-      case 2: 
-	tmp = ucg->arg.pixel.pos.x;
-	ucg->arg.pixel.pos.x = 239-tmp;
-	ucg_com_SendCmdSeq(ucg, ucg_ili9341_set_pos_dir2_seq);	
-	ucg->arg.pixel.pos.x = tmp;
-	break;
-      case 3: 
-      default: 
-	tmp = ucg->arg.pixel.pos.y;
-	ucg->arg.pixel.pos.y = 319-tmp;
-	ucg_com_SendCmdSeq(ucg, ucg_ili9341_set_pos_dir3_seq);	
-	ucg->arg.pixel.pos.y = tmp;
-	break;
-    }
+    ucg_ili9341_set_pos_dir(ucg);
     
     for( i = 0; i < ucg->arg.len; i++ )
     {
@@ -356,8 +345,8 @@ ucg_int_t ucg_dev_ic_ili9341_18(ucg_t *ucg, ucg_int_t msg, void *data)
       return 1;
 #endif /* UCG_MSG_DRAW_L90TC */
 #ifdef UCG_MSG_DRAW_L90BF
-     case UCG_MSG_DRAW_L90BF:
-      ucg_handle_l90bf(ucg, ucg_dev_ic_ili9341_18);
+    case UCG_MSG_DRAW_L90BF:
+      ucg_handle_ili9341_l90bf(ucg);
       return 1;
 #endif /* UCG_MSG_DRAW_L90BF */
     /* msg UCG_MSG_DRAW_L90SE is handled by ucg_dev_default_cb */
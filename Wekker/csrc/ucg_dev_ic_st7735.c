@@ -120,38 +120,132 @@ const ucg_pgm_uint8_t ucg_st7735_set_pos_dir3_seq[] =
   UCG_END()
 };
 
-ucg_int_t ucg_handle_st7735_l90fx(ucg_t *ucg)
+/* 
+  Native emitters for the set_pos sequences (see ucg_com_SendCmdSeq()). 
+  They send the same bytes as the sequences, but without interpreting them.
+*/
+
+static void ucg_st7735_send_cmd_range(ucg_t *ucg, uint8_t cmd, ucg_int_t start, ucg_int_t end)
+{
+  uint8_t buf[4];
+  buf[0] = start>>8;
+  buf[1] = start&255;
+  buf[2] = end>>8;
+  buf[3] = end&255;
+  ucg_com_SetCDLineStatus(ucg, (ucg->com_cfg_cd>>1)&1 );
+  ucg_com_SendByte(ucg, cmd);
+  ucg_com_SetCDLineStatus(ucg, (ucg->com_cfg_cd)&1 );
+  ucg_com_SendString(ucg, 4, buf);
+}
+
+static void ucg_st7735_set_madctl(ucg_t *ucg, uint8_t madctl)
+{
+  ucg_com_SetCDLineStatus(ucg, (ucg->com_cfg_cd>>1)&1 );
+  ucg_com_SendByte(ucg, 0x036);
+  ucg_com_SetCDLineStatus(ucg, (ucg->com_cfg_cd)&1 );
+  ucg_com_SendByte(ucg, madctl);
+}
+
+static void ucg_st7735_write_ram(ucg_t *ucg)
+{
+  ucg_com_SetCDLineStatus(ucg, (ucg->com_cfg_cd>>1)&1 );
+  ucg_com_SendByte(ucg, 0x02c);				/* write to RAM */
+  ucg_com_SetCDLineStatus(ucg, ((ucg->com_cfg_cd>>1)&1)^1 );	/* change to data mode */
+}
+
+/* x_end: last column, y_end is always the last row */
+static void ucg_st7735_emit_set_pos(ucg_t *ucg, uint8_t madctl, ucg_int_t x_end)
+{
+  ucg_com_SetCSLineStatus(ucg, 0);		/* enable chip */
+  ucg_st7735_set_madctl(ucg, madctl);
+  if ( madctl != 0 )
+    ucg_st7735_set_madctl(ucg, madctl);	/* it seems that this command needs to be sent twice */
+  ucg_st7735_send_cmd_range(ucg, 0x02a, ucg->arg.pixel.pos.x, x_end);	/* set x position */
+  ucg_st7735_send_cmd_range(ucg, 0x02b, ucg->arg.pixel.pos.y, 0x09f);	/* set y position */
+  ucg_st7735_write_ram(ucg);
+}
+
+static void ucg_st7735_emit_set_pos_dir0(ucg_t *ucg)
+{
+  ucg_st7735_emit_set_pos(ucg, 0x000, 0x07f);
+}
+
+static void ucg_st7735_emit_set_pos_dir1(ucg_t *ucg)
+{
+  ucg_st7735_emit_set_pos(ucg, 0x000, ucg->arg.pixel.pos.x);
+}
+
+static void ucg_st7735_emit_set_pos_dir2(ucg_t *ucg)
+{
+  ucg_st7735_emit_set_pos(ucg, 0x040, 0x07f);
+}
+
+static void ucg_st7735_emit_set_pos_dir3(ucg_t *ucg)
+{
+  ucg_st7735_emit_set_pos(ucg, 0x080, ucg->arg.pixel.pos.x);
+}
+
+static const ucg_cmd_seq_fast_t ucg_st7735_cmd_seq_fast[] = 
+{
+  { ucg_st7735_set_pos_seq, ucg_st7735_emit_set_pos_dir0 },
+  { ucg_st7735_set_pos_dir0_seq, ucg_st7735_emit_set_pos_dir0 },
+  { ucg_st7735_set_pos_dir1_seq, ucg_st7735_emit_set_pos_dir1 },
+  { ucg_st7735_set_pos_dir2_seq, ucg_st7735_emit_set_pos_dir2 },
+  { ucg_st7735_set_pos_dir3_seq, ucg_st7735_emit_set_pos_dir3 },
+  { NULL, NULL }
+};
+
+/*
+  Pixel data after "write to RAM" (0x2c)
+
+  The pixel format is set with 0x3a in the init sequence:
+    0x005: 16 bit, two bytes per pixel (UCG_COLOR_565)
+    0x006: 18 bit, three bytes per pixel, the lower two bits are ignored
+*/
+
+static void ucg_st7735_send_color(ucg_t *ucg, ucg_int_t cnt, ucg_color_t *color)
+{
+#if UCG_COLOR_565
+  ucg_com_SendRepeat2Bytes(ucg, cnt, color->rgb565);
+#else
+  ucg_com_SendRepeat3Bytes(ucg, cnt, color->color);
+#endif
+}
+
+/* enable chip, set the position and the direction of the line in ucg->arg and start "write to RAM" */
+static void ucg_st7735_set_pos_dir(ucg_t *ucg)
 {
-  uint8_t c[3];
   ucg_int_t tmp;
-  if ( ucg_clip_l90fx(ucg) != 0 )
+  switch(ucg->arg.dir)
   {
-    switch(ucg->arg.dir)
-    {
-      case 0: 
+    case 0: 
 	ucg_com_SendCmdSeq(ucg, ucg_st7735_set_pos_dir0_seq);	
 	break;
-      case 1: 
+    case 1: 
 	ucg_com_SendCmdSeq(ucg, ucg_st7735_set_pos_dir1_seq);	
 	break;
-      case 2: 
+    case 2: 
 	tmp = ucg->arg.pixel.pos.x;
 	ucg->arg.pixel.pos.x = 127-tmp;
 	ucg_com_SendCmdSeq(ucg, ucg_st7735_set_pos_dir2_seq);	
 	ucg->arg.pixel.pos.x = tmp;
 	break;
-      case 3: 
-      default: 
+    case 3: 
+    default: 
 	tmp = ucg->arg.pixel.pos.y;
 	ucg->arg.pixel.pos.y = 159-tmp;
 	ucg_com_SendCmdSeq(ucg, ucg_st7735_set_pos_dir3_seq);	
 	ucg->arg.pixel.pos.y = tmp;
 	break;
-    }
-    c[0] = ucg->arg.pixel.rgb.color[0];
-    c[1] = ucg->arg.pixel.rgb.color[1];
-    c[2] = ucg->arg.pixel.rgb.color[2];
-    ucg_com_SendRepeat3Bytes(ucg, ucg->arg.len, c);
+  }
+}
+
+ucg_int_t ucg_handle_st7735_l90fx(ucg_t *ucg)
+{
+  if ( ucg_clip_l90fx(ucg) != 0 )
+  {
+    ucg_st7735_set_pos_dir(ucg);
+    ucg_st7735_send_color(ucg, ucg->arg.len, &(ucg->arg.pixel.rgb));
     ucg_com_SetCSLineStatus(ucg, 1);		/* disable chip */
     return 1;
   }
@@ -159,92 +253,183 @@ ucg_int_t ucg_handle_st7735_l90fx(ucg_t *ucg)
 }
 
 /*
-  L2TC (Glyph Output)
+  Window output (solid glyphs)
+  
+  The controller fills the address window column by column and row by row.
+  Memory access control (0x36) selects the direction on the panel:
+    dir 0: 0x000, columns are x, rows are y
+    dir 1: 0x060 (MV, MX), columns are y, rows are 127-x
+    dir 2: 0x0c0 (MX, MY), columns are 127-x, rows are 159-y
+    dir 3: 0x0a0 (MV, MY), columns are 159-y, rows are x
+*/
+
+/* set the address window for the (already clipped) window in ucg->arg, enable chip and start "write to RAM" */
+static void ucg_st7735_set_win(ucg_t *ucg)
+{
+  ucg_int_t col, row;
+  uint8_t madctl;
+  
+  switch(ucg->arg.dir)
+  {
+    case 0:
+      madctl = 0x000;
+      col = ucg->arg.pixel.pos.x;
+      row = ucg->arg.pixel.pos.y;
+      break;
+    case 1:
+      madctl = 0x060;
+      col = ucg->arg.pixel.pos.y;
+      row = 127-ucg->arg.pixel.pos.x;
+      break;
+    case 2:
+      madctl = 0x0c0;
+      col = 127-ucg->arg.pixel.pos.x;
+      row = 159-ucg->arg.pixel.pos.y;
+      break;
+    case 3:
+    default:
+      madctl = 0x0a0;
+      col = 159-ucg->arg.pixel.pos.y;
+      row = ucg->arg.pixel.pos.x;
+      break;
+  }
+  
+  ucg_com_SetCSLineStatus(ucg, 0);		/* enable chip */
+  ucg_st7735_set_madctl(ucg, madctl);
+  if ( madctl != 0 )
+    ucg_st7735_set_madctl(ucg, madctl);	/* it seems that this command needs to be sent twice */
+  ucg_st7735_send_cmd_range(ucg, 0x02a, col, col + ucg->arg.len - 1);		/* set x position */
+  ucg_st7735_send_cmd_range(ucg, 0x02b, row, row + ucg->arg.lines - 1);	/* set y position */
+  ucg_st7735_write_ram(ucg);
+}
+
+ucg_int_t ucg_handle_st7735_win_open(ucg_t *ucg)
+{
+  ucg_int_t len = ucg->arg.len;
+  ucg_int_t lines = ucg->arg.lines;
+  
+  /* only windows, which are completely visible, can be streamed */
+  if ( ucg_clip_win(ucg) == 0 )
+    return 0;
+  if ( ucg->arg.len != len || ucg->arg.lines != lines )
+    return 0;
+  
+  ucg_st7735_set_win(ucg);
+  return 1;
+}
+
+/* filled box: one address window, all pixel have the same color */
+ucg_int_t ucg_handle_st7735_draw_box(ucg_t *ucg)
+{
+  ucg_int_t i;
+  
+  if ( ucg_clip_win(ucg) != 0 )
+  {
+    ucg_st7735_set_win(ucg);
+    /* one run per line, w*h may not fit into the count of the com callback */
+    for( i = 0; i < ucg->arg.lines; i++ )
+      ucg_st7735_send_color(ucg, ucg->arg.len, &(ucg->arg.pixel.rgb));
+    ucg_com_SetCSLineStatus(ucg, 1);		/* disable chip */
+  }
+  return 1;
+}
+
+/*
+  L90TC (transparent bitmap line) and L90BF (bitmap line with foreground and background)
   
+  The bits of the bitmap are sent as runs of the same color. L90BF sets the position 
+  once for the complete line, L90TC once for each run of set bits.
 */
 
-/* with CmdDataSequence */ 
 ucg_int_t ucg_handle_st7735_l90tc(ucg_t *ucg)
 {
   if ( ucg_clip_l90tc(ucg) != 0 )
   {
-    uint8_t buf[16];
     ucg_int_t dx, dy;
-    ucg_int_t i;
+    ucg_int_t i, cnt;
+    ucg_xy_t pos;
     unsigned char pixmap;
     uint8_t bitcnt;
-    ucg_com_SetCSLineStatus(ucg, 0);		/* enable chip */
-    ucg_com_SendCmdSeq(ucg, ucg_st7735_set_pos_seq);	
-
-    buf[0] = 0x001;	// change to 0 (cmd mode)
-    buf[1] = 0x02a;	// set x
-    buf[2] = 0x002;	// change to 1 (arg mode)
-    buf[3] = 0x000;	// upper part x
-    buf[4] = 0x000;	// no change
-    buf[5] = 0x000;	// will be overwritten by x value
-    buf[6] = 0x001;	// change to 0 (cmd mode)
-    buf[7] = 0x02c;	// write data
-    buf[8] = 0x002;	// change to 1 (data mode)
-    buf[9] = 0x000;	// red value
-    buf[10] = 0x000;	// no change
-    buf[11] = 0x000;	// green value
-    buf[12] = 0x000;	// no change
-    buf[13] = 0x000;	// blue value      
-    
     switch(ucg->arg.dir)
     {
-      case 0: 
-	dx = 1; dy = 0; 
-	buf[1] = 0x02a;	// set x
-	break;
-      case 1: 	
-	dx = 0; dy = 1; 
-        buf[1] = 0x02b;	// set y
-	break;
-      case 2: 
-	dx = -1; dy = 0; 
-        buf[1] = 0x02a;	// set x
-	break;
+      case 0: dx = 1; dy = 0; break;
+      case 1: dx = 0; dy = 1; break;
+      case 2: dx = -1; dy = 0; break;
       case 3: 
-      default:
-	dx = 0; dy = -1; 
-        buf[1] = 0x02b;	// set y
-	break;
+      default: dx = 0; dy = -1; break;
     }
     pixmap = ucg_pgm_read(ucg->arg.bitmap);
     bitcnt = ucg->arg.pixel_skip;
     pixmap <<= bitcnt;
-    buf[9] = ucg->arg.pixel.rgb.color[0];
-    buf[11] = ucg->arg.pixel.rgb.color[1];
-    buf[13] = ucg->arg.pixel.rgb.color[2];
-    //ucg_com_SetCSLineStatus(ucg, 0);		/* enable chip */
-    
+    pos = ucg->arg.pixel.pos;
+    cnt = 0;
+    for( i = 0; i <= ucg->arg.len; i++ )
+    {
+      if ( i < ucg->arg.len && (pixmap & 128) != 0 )
+      {
+	cnt++;
+      }
+      else if ( cnt > 0 )
+      {
+	/* end of a run: the run starts cnt pixel before the current position */
+	ucg->arg.pixel.pos.x = pos.x - cnt*dx;
+	ucg->arg.pixel.pos.y = pos.y - cnt*dy;
+	ucg_st7735_set_pos_dir(ucg);
+	ucg_st7735_send_color(ucg, cnt, &(ucg->arg.pixel.rgb));
+	cnt = 0;
+      }
+      pixmap<<=1;
+      pos.x+=dx;
+      pos.y+=dy;
+      bitcnt++;
+      if ( bitcnt >= 8 && i+1 < ucg->arg.len )
+      {
+	ucg->arg.bitmap++;
+	pixmap = ucg_pgm_read(ucg->arg.bitmap);
+	bitcnt = 0;
+      }
+    }
+    ucg_com_SetCSLineStatus(ucg, 1);		/* disable chip */
+    return 1;
+  }
+  return 0;
+}
+
+ucg_int_t ucg_handle_st7735_l90bf(ucg_t *ucg)
+{
+  if ( ucg->arg.scale != 1 )
+    return ucg_handle_l90bf(ucg, ucg_dev_ic_st7735_18);	/* upscaled bitmaps are drawn pixel by pixel */
+  if ( ucg_clip_l90tc(ucg) != 0 )
+  {
+    ucg_int_t i, cnt;
+    unsigned char pixmap;
+    uint8_t bitcnt, bit;
+    ucg_st7735_set_pos_dir(ucg);
+    pixmap = ucg_pgm_read(ucg->arg.bitmap);
+    bitcnt = ucg->arg.pixel_skip;
+    pixmap <<= bitcnt;
+    bit = pixmap & 128;
+    cnt = 0;
     for( i = 0; i < ucg->arg.len; i++ )
     {
-      if ( (pixmap & 128) != 0 )
+      if ( (pixmap & 128) != bit )
       {
-	if ( (ucg->arg.dir&1) == 0 )
-	{
-	  buf[5] = ucg->arg.pixel.pos.x;
-	}
-	else
-	{
-	  buf[3] = ucg->arg.pixel.pos.y>>8;
-	  buf[5] = ucg->arg.pixel.pos.y&255;
-	}
-	ucg_com_SendCmdDataSequence(ucg, 7, buf, 0);
+	/* set bits use color 0, cleared bits color 1, like ucg_handle_l90bf() */
+	ucg_st7735_send_color(ucg, cnt, ucg->arg.rgb + (bit != 0 ? 0 : 1));
+	bit = pixmap & 128;
+	cnt = 0;
       }
+      cnt++;
       pixmap<<=1;
-      ucg->arg.pixel.pos.x+=dx;
-      ucg->arg.pixel.pos.y+=dy;
       bitcnt++;
-      if ( bitcnt >= 8 )
+      if ( bitcnt >= 8 && i+1 < ucg->arg.len )
       {
 	ucg->arg.bitmap++;
 	pixmap = ucg_pgm_read(ucg->arg.bitmap);
 	bitcnt = 0;
       }
     }
+    ucg_st7735_send_color(ucg, cnt, ucg->arg.rgb + (bit != 0 ? 0 : 1));
     ucg_com_SetCSLineStatus(ucg, 1);		/* disable chip */
     return 1;
   }
@@ -255,8 +440,7 @@ ucg_int_t ucg_handle_st7735_l90tc(ucg_t *ucg)
 ucg_int_t ucg_handle_st7735_l90se(ucg_t *ucg)
 {
   uint8_t i;
-  uint8_t c[3];
-  ucg_int_t tmp;
+  ucg_color_t c;
   
   /* Setup ccs for l90se. This will be updated by ucg_clip_l90se if required */
   
@@ -270,35 +454,17 @@ ucg_int_t ucg_handle_st7735_l90se(ucg_t *ucg)
   if ( ucg_clip_l90se(ucg) != 0 )
   {
     ucg_int_t i;
-    switch(ucg->arg.dir)
-    {
-      case 0: 
-	ucg_com_SendCmdSeq(ucg, ucg_st7735_set_pos_dir0_seq);	
-	break;
-      case 1: 
-	ucg_com_SendCmdSeq(ucg, ucg_st7735_set_pos_dir1_seq);	
-	break;
-      case 2: 
-	tmp = ucg->arg.pixel.pos.x;
-	ucg->arg.pixel.pos.x = 127-tmp;
-	ucg_com_SendCmdSeq(ucg, ucg_st7735_set_pos_dir2_seq);	
-	ucg->arg.pixel.pos.x = tmp;
-	break;
-      case 3: 
-      default: 
-	tmp = ucg->arg.pixel.pos.y;
-	ucg->arg.pixel.pos.y = 159-tmp;
-	ucg_com_SendCmdSeq(ucg, ucg_st7735_set_pos_dir3_seq);	
-	ucg->arg.pixel.pos.y = tmp;
-	break;
-    }
+    ucg_st7735_set_pos_dir(ucg);
     
     for( i = 0; i < ucg->arg.len; i++ )
     {
-      c[0] = ucg->arg.ccs_line[0].current;
-      c[1] = ucg->arg.ccs_line[1].current; 
-      c[2] = ucg->arg.ccs_line[2].current;
-      ucg_com_SendRepeat3Bytes(ucg, 1, c);
+      c.color[0] = ucg->arg.ccs_line[0].current;
+      c.color[1] = ucg->arg.ccs_line[1].current; 
+      c.color[2] = ucg->arg.ccs_line[2].current;
+#if UCG_COLOR_565
+      ucg_color_Set565(&c);
+#endif
+      ucg_st7735_send_color(ucg, 1, &c);
       ucg_ccs_step(ucg->arg.ccs_line+0);
       ucg_ccs_step(ucg->arg.ccs_line+1);
       ucg_ccs_step(ucg->arg.ccs_line+2);
@@ -310,6 +476,244 @@ ucg_int_t ucg_handle_st7735_l90se(ucg_t *ucg)
 }
 
 
+/*
+  Hardware rotation (UCG_MSG_SET_HW_ROTATE)
+  
+  Memory access control (0x36) is set once for the rotation, then the 
+  column and row addresses are the x and y coordinates of the rotated 
+  display. The same values as for the window directions:
+    0: 0x000, 1: 0x060 (MV, MX), 2: 0x0c0 (MX, MY), 3: 0x0a0 (MV, MY)
+  
+  Lines and boxes are sent into an address window, which covers the pixel.
+  The order of the pixel inside the window is fixed (dir 0), so lines with 
+  different colors in dir 2 and 3 need one window per run. Gradients in dir 2 
+  and 3 and windows which are not in dir 0 use the generic procedures.
+*/
+
+static const uint8_t ucg_st7735_hw_madctl[4] = { 0x000, 0x060, 0x0c0, 0x0a0 };
+
+static void ucg_st7735_hw_set_rotate(ucg_t *ucg, uint8_t rotate)
+{
+  ucg->hw_rotate = rotate & 3;
+  ucg_com_SetCSLineStatus(ucg, 0);		/* enable chip */
+  ucg_st7735_set_madctl(ucg, ucg_st7735_hw_madctl[ucg->hw_rotate]);
+  if ( ucg->hw_rotate != 0 )
+    ucg_st7735_set_madctl(ucg, ucg_st7735_hw_madctl[ucg->hw_rotate]);	/* it seems that this command needs to be sent twice */
+  ucg_com_SetCSLineStatus(ucg, 1);		/* disable chip */
+}
+
+/* enable chip, set the address window and start "write to RAM" */
+static void ucg_st7735_hw_win(ucg_t *ucg, ucg_int_t x0, ucg_int_t y0, ucg_int_t x1, ucg_int_t y1)
+{
+  ucg_com_SetCSLineStatus(ucg, 0);		/* enable chip */
+  ucg_st7735_send_cmd_range(ucg, 0x02a, x0, x1);	/* set x position */
+  ucg_st7735_send_cmd_range(ucg, 0x02b, y0, y1);	/* set y position */
+  ucg_st7735_write_ram(ucg);
+}
+
+/* address window for "len" pixel from ucg->arg.pixel.pos in direction ucg->arg.dir */
+static void ucg_st7735_hw_line(ucg_t *ucg, ucg_int_t len)
+{
+  ucg_int_t x = ucg->arg.pixel.pos.x;
+  ucg_int_t y = ucg->arg.pixel.pos.y;
+  switch(ucg->arg.dir)
+  {
+    case 0: ucg_st7735_hw_win(ucg, x, y, x+len-1, y); break;
+    case 1: ucg_st7735_hw_win(ucg, x, y, x, y+len-1); break;
+    case 2: ucg_st7735_hw_win(ucg, x-len+1, y, x, y); break;
+    case 3: 
+    default: ucg_st7735_hw_win(ucg, x, y-len+1, x, y); break;
+  }
+}
+
+/* address window for the (already clipped) window in ucg->arg, see ucg_clip_win() */
+static void ucg_st7735_hw_rect(ucg_t *ucg)
+{
+  ucg_int_t x = ucg->arg.pixel.pos.x;
+  ucg_int_t y = ucg->arg.pixel.pos.y;
+  ucg_int_t len = ucg->arg.len;
+  ucg_int_t lines = ucg->arg.lines;
+  switch(ucg->arg.dir)
+  {
+    case 0: ucg_st7735_hw_win(ucg, x, y, x+len-1, y+lines-1); break;
+    case 1: ucg_st7735_hw_win(ucg, x-lines+1, y, x, y+len-1); break;
+    case 2: ucg_st7735_hw_win(ucg, x-len+1, y-lines+1, x, y); break;
+    case 3: 
+    default: ucg_st7735_hw_win(ucg, x, y-len+1, x+lines-1, y); break;
+  }
+}
+
+/* 
+  Send the bits of a bitmap line as runs. is_transparent: cleared bits are 
+  skipped, otherwise they have color 1 (like ucg_handle_l90bf()).
+*/
+static void ucg_st7735_hw_bitmap(ucg_t *ucg, uint8_t is_transparent)
+{
+  ucg_int_t dx, dy;
+  ucg_int_t i, cnt;
+  ucg_xy_t pos;
+  ucg_color_t *color;
+  unsigned char pixmap;
+  uint8_t bitcnt, bit;
+  uint8_t is_one_win;
+  
+  switch(ucg->arg.dir)
+  {
+    case 0: dx = 1; dy = 0; break;
+    case 1: dx = 0; dy = 1; break;
+    case 2: dx = -1; dy = 0; break;
+    case 3: 
+    default: dx = 0; dy = -1; break;
+  }
+  
+  /* in dir 0 and 1 the pixel order of the window is the order of the line */
+  is_one_win = ( is_transparent == 0 && ucg->arg.dir < 2 );
+  if ( is_one_win )
+    ucg_st7735_hw_line(ucg, ucg->arg.len);
+  
+  pixmap = ucg_pgm_read(ucg->arg.bitmap);
+  bitcnt = ucg->arg.pixel_skip;
+  pixmap <<= bitcnt;
+  pos = ucg->arg.pixel.pos;
+  bit = pixmap & 128;
+  cnt = 0;
+  for( i = 0; i <= ucg->arg.len; i++ )
+  {
+    if ( i < ucg->arg.len && (pixmap & 128) == bit )
+    {
+      cnt++;
+    }
+    else
+    {
+      /* end of a run: the run starts cnt pixel before the current position */
+      if ( is_transparent != 0 )
+	color = &(ucg->arg.pixel.rgb);
+      else if ( bit != 0 )
+	color = ucg->arg.rgb;
+      else
+	color = ucg->arg.rgb + 1;
+      if ( bit != 0 || is_transparent == 0 )
+      {
+	if ( is_one_win == 0 )
+	{
+	  ucg->arg.pixel.pos.x = pos.x - cnt*dx;
+	  ucg->arg.pixel.pos.y = pos.y - cnt*dy;
+	  ucg_st7735_hw_line(ucg, cnt);
+	}
+	ucg_st7735_send_color(ucg, cnt, color);
+      }
+      bit = pixmap & 128;
+      cnt = 1;
+    }
+    pixmap<<=1;
+    pos.x+=dx;
+    pos.y+=dy;
+    bitcnt++;
+    if ( bitcnt >= 8 && i+1 < ucg->arg.len )
+    {
+      ucg->arg.bitmap++;
+      pixmap = ucg_pgm_read(ucg->arg.bitmap);
+      bitcnt = 0;
+    }
+  }
+  ucg_com_SetCSLineStatus(ucg, 1);		/* disable chip */
+}
+
+static void ucg_st7735_hw_l90se(ucg_t *ucg)
+{
+  uint8_t i;
+  ucg_color_t c;
+  
+  for ( i = 0; i < 3; i++ )
+  {
+    ucg_ccs_init(ucg->arg.ccs_line+i, ucg->arg.rgb[0].color[i], ucg->arg.rgb[1].color[i], ucg->arg.len);
+  }
+  if ( ucg_clip_l90se(ucg) != 0 )
+  {
+    ucg_int_t i;
+    ucg_st7735_hw_line(ucg, ucg->arg.len);
+    for( i = 0; i < ucg->arg.len; i++ )
+    {
+      c.color[0] = ucg->arg.ccs_line[0].current;
+      c.color[1] = ucg->arg.ccs_line[1].current; 
+      c.color[2] = ucg->arg.ccs_line[2].current;
+#if UCG_COLOR_565
+      ucg_color_Set565(&c);
+#endif
+      ucg_st7735_send_color(ucg, 1, &c);
+      ucg_ccs_step(ucg->arg.ccs_line+0);
+      ucg_ccs_step(ucg->arg.ccs_line+1);
+      ucg_ccs_step(ucg->arg.ccs_line+2);
+    }
+    ucg_com_SetCSLineStatus(ucg, 1);		/* disable chip */
+  }
+}
+
+/* drawing messages, if the controller is rotated */
+static ucg_int_t ucg_dev_ic_st7735_hw(ucg_t *ucg, ucg_int_t msg, void *data)
+{
+  ucg_int_t len, lines;
+  
+  switch(msg)
+  {
+    case UCG_MSG_DRAW_PIXEL:
+      if ( ucg_clip_is_pixel_visible(ucg) !=0 )
+      {
+	ucg_st7735_hw_line(ucg, 1);
+	ucg_st7735_send_color(ucg, 1, &(ucg->arg.pixel.rgb));
+	ucg_com_SetCSLineStatus(ucg, 1);		/* disable chip */
+      }
+      return 1;
+    case UCG_MSG_DRAW_L90FX:
+      if ( ucg_clip_l90fx(ucg) != 0 )
+      {
+	ucg_st7735_hw_line(ucg, ucg->arg.len);
+	ucg_st7735_send_color(ucg, ucg->arg.len, &(ucg->arg.pixel.rgb));
+	ucg_com_SetCSLineStatus(ucg, 1);		/* disable chip */
+      }
+      return 1;
+#ifdef UCG_MSG_DRAW_L90TC
+    case UCG_MSG_DRAW_L90TC:
+      if ( ucg_clip_l90tc(ucg) != 0 )
+	ucg_st7735_hw_bitmap(ucg, 1);
+      return 1;
+#endif /* UCG_MSG_DRAW_L90TC */
+#ifdef UCG_MSG_DRAW_L90BF
+    case UCG_MSG_DRAW_L90BF:
+      if ( ucg->arg.scale != 1 )
+	return ucg_handle_l90bf(ucg, ucg_dev_ic_st7735_18);
+      if ( ucg_clip_l90tc(ucg) != 0 )
+	ucg_st7735_hw_bitmap(ucg, 0);
+      return 1;
+#endif /* UCG_MSG_DRAW_L90BF */
+    case UCG_MSG_DRAW_L90SE:
+      if ( ucg->arg.dir >= 2 )
+	return ucg_handle_l90se(ucg, ucg_dev_ic_st7735_18);
+      ucg_st7735_hw_l90se(ucg);
+      return 1;
+    case UCG_MSG_WIN_OPEN:
+      len = ucg->arg.len;
+      lines = ucg->arg.lines;
+      /* only windows in dir 0, which are completely visible, can be streamed */
+      if ( ucg->arg.dir != 0 || ucg_clip_win(ucg) == 0 )
+	return 0;
+      if ( ucg->arg.len != len || ucg->arg.lines != lines )
+	return 0;
+      ucg_st7735_hw_rect(ucg);
+      return 1;
+    case UCG_MSG_DRAW_BOX:
+      if ( ucg_clip_win(ucg) != 0 )
+      {
+	ucg_st7735_hw_rect(ucg);
+	for( len = 0; len < ucg->arg.lines; len++ )
+	  ucg_st7735_send_color(ucg, ucg->arg.len, &(ucg->arg.pixel.rgb));
+	ucg_com_SetCSLineStatus(ucg, 1);		/* disable chip */
+      }
+      return 1;
+  }
+  return ucg_dev_ic_st7735_18(ucg, msg, data);
+}
+
 static const ucg_pgm_uint8_t ucg_st7735_power_down_seq[] = {
 	UCG_CS(0),					/* enable chip */
 	UCG_C10(0x010),				/* sleep in */
@@ -320,28 +724,46 @@ static const ucg_pgm_uint8_t ucg_st7735_power_down_seq[] = {
 
 ucg_int_t ucg_dev_ic_st7735_18(ucg_t *ucg, ucg_int_t msg, void *data)
 {
+  if ( ucg->hw_rotate != 0 && msg >= UCG_MSG_DRAW_PIXEL && msg <= UCG_MSG_DRAW_BOX && msg != UCG_MSG_WIN_RUN && msg != UCG_MSG_WIN_CLOSE )
+  {
+    /* with hardware rotation, the drawing messages are handled by ucg_dev_ic_st7735_hw() */
+    /* ucg_dev_ic_st7735_hw() calls this procedure for WIN_RUN and WIN_CLOSE */
+    return ucg_dev_ic_st7735_hw(ucg, msg, data);
+  }
+  
   switch(msg)
   {
     case UCG_MSG_DEV_POWER_UP:
       /* setup com interface and provide information on the clock speed */
       /* of the serial and parallel interface. Values are nanoseconds. */
+#if UCG_CMD_SEQ_FAST
+      ucg->cmd_seq_fast = ucg_st7735_cmd_seq_fast;
+#endif
+      ucg->hw_rotate = 0;	/* the init sequence sets memory access control to 0 */
       return ucg_com_PowerUp(ucg, 100, 66);
     case UCG_MSG_DEV_POWER_DOWN:
       ucg_com_SendCmdSeq(ucg, ucg_st7735_power_down_seq);
       return 1;
     case UCG_MSG_GET_DIMENSION:
-      ((ucg_wh_t *)data)->w = 128;
-      ((ucg_wh_t *)data)->h = 160;
+      if ( (ucg->hw_rotate & 1) != 0 )
+      {
+	((ucg_wh_t *)data)->w = 160;
+	((ucg_wh_t *)data)->h = 128;
+      }
+      else
+      {
+	((ucg_wh_t *)data)->w = 128;
+	((ucg_wh_t *)data)->h = 160;
+      }
+      return 1;
+    case UCG_MSG_SET_HW_ROTATE:
+      ucg_st7735_hw_set_rotate(ucg, *(uint8_t *)data);
       return 1;
     case UCG_MSG_DRAW_PIXEL:
       if ( ucg_clip_is_pixel_visible(ucg) !=0 )
       {
-	uint8_t c[3];
 	ucg_com_SendCmdSeq(ucg, ucg_st7735_set_pos_seq);	
-	c[0] = ucg->arg.pixel.rgb.color[0];
-	c[1] = ucg->arg.pixel.rgb.color[1];
-	c[2] = ucg->arg.pixel.rgb.color[2];
-	ucg_com_SendRepeat3Bytes(ucg, 1, c);
+	ucg_st7735_send_color(ucg, 1, &(ucg->arg.pixel.rgb));
 	ucg_com_SetCSLineStatus(ucg, 1);		/* disable chip */
       }
       return 1;
@@ -349,6 +771,16 @@ ucg_int_t ucg_dev_ic_st7735_18(ucg_t *ucg, ucg_int_t msg, void *data)
       //ucg_handle_l90fx(ucg, ucg_dev_ic_st7735_18);
       ucg_handle_st7735_l90fx(ucg);
       return 1;
+    case UCG_MSG_WIN_OPEN:
+      return ucg_handle_st7735_win_open(ucg);
+    case UCG_MSG_WIN_RUN:
+      ucg_st7735_send_color(ucg, ucg->arg.len, &(ucg->arg.pixel.rgb));
+      return 1;
+    case UCG_MSG_WIN_CLOSE:
+      ucg_com_SetCSLineStatus(ucg, 1);		/* disable chip */
+      return 1;
+    case UCG_MSG_DRAW_BOX:
+      return ucg_handle_st7735_draw_box(ucg);
 #ifdef UCG_MSG_DRAW_L90TC
     case UCG_MSG_DRAW_L90TC:
       //ucg_handle_l90tc(ucg, ucg_dev_ic_st7735_18);
@@ -356,8 +788,8 @@ ucg_int_t ucg_dev_ic_st7735_18(ucg_t *ucg, ucg_int_t msg, void *data)
       return 1;	
 #endif /* UCG_MSG_DRAW_L90TC */
 #ifdef UCG_MSG_DRAW_L90BF
-     case UCG_MSG_DRAW_L90BF:
-      ucg_handle_l90bf(ucg, ucg_dev_ic_st7735_18);
+    case UCG_MSG_DRAW_L90BF:
+      ucg_handle_st7735_l90bf(ucg);
       return 1;
 #endif /* UCG_MSG_DRAW_L90BF */
       
@@ -61,6 +61,8 @@ ucg_int_t ucg_PowerUp(ucg_t *ucg)
 
 void ucg_SetClipBox(ucg_t *ucg, ucg_box_t *clip_box)
 {
+  /* the rotation callbacks modify the box */
+  ucg->user_clip_box = *clip_box;
   ucg->device_cb(ucg, UCG_MSG_SET_CLIP_BOX, (void *)(clip_box));
 }
 
@@ -122,6 +124,12 @@ void ucg_DrawL90SEWithArg(ucg_t *ucg)
   ucg->device_cb(ucg, UCG_MSG_DRAW_L90SE, &(ucg->arg));
 }
 
+/* returns 0 if the device does not support UCG_MSG_DRAW_BOX */
+ucg_int_t ucg_DrawBoxWithArg(ucg_t *ucg)
+{
+  return ucg->device_cb(ucg, UCG_MSG_DRAW_BOX, &(ucg->arg));
+}
+
 /*
 void ucg_DrawL90RLWithArg(ucg_t *ucg)
 {
@@ -59,8 +59,11 @@ static const ucg_pgm_uint8_t ucg_tft_128x160_st7735_init_seq[] = {
   UCG_C10(0x20), 				/* not inverted */
   //UCG_C10(0x21), 				/* inverted */
 
+#if UCG_COLOR_565
+  UCG_C11(0x03a, 0x005), 		/* set pixel format to 16 bit */
+#else
   UCG_C11(0x03a, 0x006), 		/* set pixel format to 18 bit */
-  //UCG_C11(0x03a, 0x005), 		/* set pixel format to 16 bit */
+#endif
 
   //UCG_C12(0x0b1, 0x000, 0x01b), 	/* frame rate control (POR values) */
   //UCG_C10(0x28), 				/* display off */
@@ -101,9 +104,8 @@ ucg_int_t ucg_dev_st7735_18x128x160(ucg_t *ucg, ucg_int_t msg, void *data)
       return ucg_dev_ic_st7735_18(ucg, msg, data);  
     
     case UCG_MSG_GET_DIMENSION:
-      ((ucg_wh_t *)data)->w = 128;
-      ((ucg_wh_t *)data)->h = 160;
-      return 1;
+      /* the controller swaps width and height, if it is rotated (UCG_MSG_SET_HW_ROTATE) */
+      return ucg_dev_ic_st7735_18(ucg, msg, data);
   }
   
   /* all other messages are handled by the controller procedures */
@@ -100,6 +100,27 @@ typedef void * ucg_glyph_t;
   19		1		start pos 'a' high byte
   20		1		start pos 'a' low byte
 
+  Glyph data, RLE format:
+  0		1		encoding
+  1		1		size of the glyph data (offset to the next glyph), 0: end of the font
+  2		...		width, height, x, y, delta x and the run length code
+
+  Glyph data, expanded format (bbx_mode has UCG_FONT_BBX_MODE_EXPANDED set):
+  0		1		encoding
+  1		1		size of the glyph data (offset to the next glyph), 0: end of the font
+  2		1		width
+  3		1		height
+  4		1		x offset, signed
+  5		1		y offset, signed
+  6		1		delta x, signed
+  7		2*n		n pairs: number of background pixel, number of foreground pixel
+  
+  The pairs are the decoded run length code, a run continues over the end 
+  of a row. The expanded format does not need the RLE parameters of the 
+  header, they are kept unchanged. It is about twice as large as the RLE 
+  format, but a glyph is drawn without bit stream decoding. 
+  host/fontsubset.c converts fonts.
+
   Font build mode, 0: proportional, 1: common height, 2: monospace, 3: multiple of 8
 
   Font build mode 0:		
@@ -639,6 +660,71 @@ void ucg_font_decode_len(ucg_t *ucg, uint8_t len, uint8_t is_foreground)
   
 }
 
+/*
+  Description:
+    Send the next pixel of a run to the window, which has been opened for the glyph.
+  Args:
+    len:		number of pixels of the run
+    col_idx:	0 for foreground, 1 for background
+*/
+static void ucg_font_decode_win_run(ucg_t *ucg, uint8_t len, uint8_t col_idx)
+{
+  ucg_font_decode_t *decode = &(ucg->font_decode);
+  if ( len > decode->win_rem )
+    len = decode->win_rem;
+  if ( len > 0 )
+  {
+    ucg->arg.pixel.rgb = ucg->arg.rgb[col_idx];
+    ucg->arg.len = len;
+    ucg->device_cb(ucg, UCG_MSG_WIN_RUN, &(ucg->arg));
+    decode->win_rem -= len;
+  }
+}
+
+/*
+  Description:
+    Solid mode only: Open the bounding box of the glyph as one window.
+    All runs are streamed into this window by ucg_font_decode_pair().
+  Return:
+    0, if the device could not open the window.
+*/
+static uint8_t ucg_font_decode_win_open(ucg_t *ucg)
+{
+  ucg_font_decode_t *decode = &(ucg->font_decode);
+  
+  ucg->arg.pixel.pos.x = decode->target_x;
+  ucg->arg.pixel.pos.y = decode->target_y;
+  ucg->arg.len = decode->glyph_width;
+  ucg->arg.lines = decode->glyph_height;
+  ucg->arg.dir = decode->dir;
+  if ( ucg->device_cb(ucg, UCG_MSG_WIN_OPEN, &(ucg->arg)) == 0 )
+    return 0;
+  decode->win_rem = (uint16_t)decode->glyph_width * (uint16_t)decode->glyph_height;
+  return 1;
+}
+
+/*
+  Description:
+    Draw "a" background pixel followed by "b" foreground pixel, either
+    into the open window or as lines.
+*/
+static void ucg_font_decode_pair(ucg_t *ucg, uint8_t a, uint8_t b)
+{
+  ucg_font_decode_t *decode = &(ucg->font_decode);
+  if ( decode->is_win != 0 )
+  {
+    ucg_font_decode_win_run(ucg, a, 1);
+    ucg_font_decode_win_run(ucg, b, 0);
+    if ( decode->win_rem == 0 )
+      decode->y = decode->glyph_height;		/* end of glyph */
+  }
+  else
+  {
+    ucg_font_decode_len(ucg, a, 0);
+    ucg_font_decode_len(ucg, b, 1);
+  }
+}
+
 static void ucg_font_setup_decode(ucg_t *ucg, const uint8_t *glyph_data)
 {
   ucg_font_decode_t *decode = &(ucg->font_decode);
@@ -652,6 +738,97 @@ static void ucg_font_setup_decode(ucg_t *ucg, const uint8_t *glyph_data)
   decode->glyph_height = ucg_font_decode_get_unsigned_bits(decode,ucg->font_info.bits_per_char_height);
 }
 
+/*===============================================*/
+/* glyph cache */
+
+#if UCG_FONT_CACHE_ENTRIES > 0
+
+struct _ucg_font_cache_entry_t
+{
+  const uint8_t *glyph_data;		/* key: glyph data inside the font, unique for font and encoding, NULL if unused */
+  uint16_t last_use;				/* LRU time stamp, 0: do not keep this entry */
+  int8_t glyph_width;
+  int8_t glyph_height;
+  int8_t x;
+  int8_t y;
+  int8_t d;
+  uint8_t cnt;					/* number of run pairs */
+  uint8_t runs[UCG_FONT_CACHE_RUNS*2];	/* background and foreground length of each pair */
+};
+typedef struct _ucg_font_cache_entry_t ucg_font_cache_entry_t;
+
+static ucg_font_cache_entry_t ucg_font_cache[UCG_FONT_CACHE_ENTRIES];
+static uint16_t ucg_font_cache_clock;
+ucg_font_cache_stat_t ucg_font_cache_stat;
+
+/*
+  Description:
+    Search the glyph in the cache. On a cache miss, the least recently used
+    entry is cleared and returned, so that the decoder can fill it.
+  Return:
+    Entry with glyph_data set for a cache hit, entry with glyph_data == NULL 
+    for a cache miss.
+*/
+static ucg_font_cache_entry_t *ucg_font_cache_get(const uint8_t *glyph_data)
+{
+  ucg_font_cache_entry_t *e;
+  ucg_font_cache_entry_t *lru;
+  uint8_t i;
+  
+  ucg_font_cache_clock++;
+  if ( ucg_font_cache_clock == 0 )
+  {
+    /* restart the time stamps, keep the cached glyphs */
+    for( i = 0; i < UCG_FONT_CACHE_ENTRIES; i++ )
+      if ( ucg_font_cache[i].last_use != 0 )
+	ucg_font_cache[i].last_use = 1;
+    ucg_font_cache_clock = 2;
+  }
+  
+  lru = ucg_font_cache;
+  for( i = 0, e = ucg_font_cache; i < UCG_FONT_CACHE_ENTRIES; i++, e++ )
+  {
+    if ( e->glyph_data == glyph_data )
+    {
+      e->last_use = ucg_font_cache_clock;
+      ucg_font_cache_stat.hit++;
+      return e;
+    }
+    if ( e->last_use < lru->last_use )
+      lru = e;
+  }
+  
+  ucg_font_cache_stat.miss++;
+  lru->glyph_data = NULL;
+  lru->last_use = ucg_font_cache_clock;
+  lru->cnt = 0;
+  return lru;
+}
+
+/* remember one pair, drop the entry if the glyph has too many runs */
+static void ucg_font_cache_add_pair(ucg_font_cache_entry_t *e, uint8_t a, uint8_t b)
+{
+  if ( e->cnt >= UCG_FONT_CACHE_RUNS )
+  {
+    e->last_use = 0;
+    return;
+  }
+  e->runs[e->cnt*2] = a;
+  e->runs[e->cnt*2+1] = b;
+  e->cnt++;
+}
+
+void ucg_ClearFontCache(void)
+{
+  uint8_t i;
+  for( i = 0; i < UCG_FONT_CACHE_ENTRIES; i++ )
+  {
+    ucg_font_cache[i].glyph_data = NULL;
+    ucg_font_cache[i].last_use = 0;
+  }
+}
+
+#endif /* UCG_FONT_CACHE_ENTRIES > 0 */
 
 /*
   Description:
@@ -674,13 +851,28 @@ int8_t ucg_font_decode_glyph(ucg_t *ucg, const uint8_t *glyph_data)
   int8_t d;
   int8_t h;
   ucg_font_decode_t *decode = &(ucg->font_decode);
-    
-  ucg_font_setup_decode(ucg, glyph_data);
-  h = ucg->font_decode.glyph_height;
+#if UCG_FONT_CACHE_ENTRIES > 0
+  ucg_font_cache_entry_t *e;
   
-  x = ucg_font_decode_get_signed_bits(decode, ucg->font_info.bits_per_char_x);
-  y = ucg_font_decode_get_signed_bits(decode, ucg->font_info.bits_per_char_y);
-  d = ucg_font_decode_get_signed_bits(decode, ucg->font_info.bits_per_delta_x);
+  e = ucg_font_cache_get(glyph_data);
+  if ( e->glyph_data != NULL )
+  {
+    /* cache hit: no need to decode the glyph */
+    decode->glyph_width = e->glyph_width;
+    decode->glyph_height = e->glyph_height;
+    x = e->x;
+    y = e->y;
+    d = e->d;
+  }
+  else
+#endif /* UCG_FONT_CACHE_ENTRIES > 0 */
+  {
+    ucg_font_setup_decode(ucg, glyph_data);
+    x = ucg_font_decode_get_signed_bits(decode, ucg->font_info.bits_per_char_x);
+    y = ucg_font_decode_get_signed_bits(decode, ucg->font_info.bits_per_char_y);
+    d = ucg_font_decode_get_signed_bits(decode, ucg->font_info.bits_per_delta_x);
+  }
+  h = decode->glyph_height;
   
   if ( decode->glyph_width > 0 )
   {
@@ -688,28 +880,122 @@ int8_t ucg_font_decode_glyph(ucg_t *ucg, const uint8_t *glyph_data)
     decode->target_y = ucg_add_vector_y(decode->target_y, x, -(h+y), decode->dir);
     //ucg_add_vector(&(decode->target_x), &(decode->target_y), x, -(h+y), decode->dir);
    
+    /* solid glyphs are sent as one window, if the device supports this */
+    decode->is_win = 0;
+    if ( decode->is_transparent == 0 && h > 0 )
+      decode->is_win = ucg_font_decode_win_open(ucg);
+    
     /* reset local x/y position */
     decode->x = 0;
     decode->y = 0;
     
-    /* decode glyph */
-    for(;;)
+#if UCG_FONT_CACHE_ENTRIES > 0
+    if ( e->glyph_data != NULL )
+    {
+      /* replay the runs from the cache */
+      for( a = 0; a < e->cnt; a++ )
+	ucg_font_decode_pair(ucg, e->runs[a*2], e->runs[a*2+1]);
+    }
+    else
+#endif /* UCG_FONT_CACHE_ENTRIES > 0 */
     {
-      a = ucg_font_decode_get_unsigned_bits(decode, ucg->font_info.bits_per_0);
-      b = ucg_font_decode_get_unsigned_bits(decode, ucg->font_info.bits_per_1);
-      do
+      /* decode glyph */
+      for(;;)
       {
-	ucg_font_decode_len(ucg, a, 0);
-	ucg_font_decode_len(ucg, b, 1);
-      } while( ucg_font_decode_get_unsigned_bits(decode, 1) != 0 );
-
-      if ( decode->y >= h )
-	break;
+	a = ucg_font_decode_get_unsigned_bits(decode, ucg->font_info.bits_per_0);
+	b = ucg_font_decode_get_unsigned_bits(decode, ucg->font_info.bits_per_1);
+	do
+	{
+	  ucg_font_decode_pair(ucg, a, b);
+#if UCG_FONT_CACHE_ENTRIES > 0
+	  ucg_font_cache_add_pair(e, a, b);
+#endif /* UCG_FONT_CACHE_ENTRIES > 0 */
+	} while( ucg_font_decode_get_unsigned_bits(decode, 1) != 0 );
+
+	if ( decode->y >= h )
+	  break;
+      }
     }
+    
+    if ( decode->is_win != 0 )
+      ucg->device_cb(ucg, UCG_MSG_WIN_CLOSE, &(ucg->arg));
+  }
+  
+#if UCG_FONT_CACHE_ENTRIES > 0
+  if ( e->glyph_data == NULL && e->last_use != 0 )
+  {
+    /* the glyph has been decoded completely, keep it in the cache */
+    e->glyph_data = glyph_data;
+    e->glyph_width = decode->glyph_width;
+    e->glyph_height = h;
+    e->x = x;
+    e->y = y;
+    e->d = d;
   }
+#endif /* UCG_FONT_CACHE_ENTRIES > 0 */
   return d;
 }
 
+/*
+  Description:
+    Draw a glyph of a font with the expanded format: The pairs of background 
+    and foreground runs are read byte by byte, no bit stream decoding.
+  Args:
+    glyph_data: 					Pointer to the glyph data of the font
+    ucg->font_decode.target_x		X position
+    ucg->font_decode.target_y		Y position
+    ucg->font_decode.is_transparent	Transparent mode
+  Return:
+    Width (delta x advance) of the glyph.
+*/
+int8_t ucg_font_decode_glyph_expanded(ucg_t *ucg, const uint8_t *glyph_data)
+{
+  uint8_t a, b;
+  uint8_t cnt;
+  int8_t x, y;
+  int8_t h;
+  ucg_font_decode_t *decode = &(ucg->font_decode);
+  const uint8_t *p = glyph_data;
+
+  cnt = ucg_pgm_read( (ucg_pgm_uint8_t *)(p+1) );
+  decode->glyph_width = ucg_pgm_read( (ucg_pgm_uint8_t *)(p+2) );
+  h = ucg_pgm_read( (ucg_pgm_uint8_t *)(p+3) );
+  decode->glyph_height = h;
+  x = ucg_pgm_read( (ucg_pgm_uint8_t *)(p+4) );
+  y = ucg_pgm_read( (ucg_pgm_uint8_t *)(p+5) );
+  
+  if ( decode->glyph_width > 0 )
+  {
+    decode->target_x = ucg_add_vector_x(decode->target_x, x, -(h+y), decode->dir);
+    decode->target_y = ucg_add_vector_y(decode->target_y, x, -(h+y), decode->dir);
+
+    decode->is_win = 0;
+    if ( decode->is_transparent == 0 && h > 0 )
+      decode->is_win = ucg_font_decode_win_open(ucg);
+    
+    decode->x = 0;
+    decode->y = 0;
+    
+    /* number of run pairs */
+    cnt -= 7;
+    cnt >>= 1;
+    p += 7;
+    while( cnt > 0 )
+    {
+      a = ucg_pgm_read( (ucg_pgm_uint8_t *)p );
+      p++;
+      b = ucg_pgm_read( (ucg_pgm_uint8_t *)p );
+      p++;
+      ucg_font_decode_pair(ucg, a, b);
+      cnt--;
+    }
+    
+    if ( decode->is_win != 0 )
+      ucg->device_cb(ucg, UCG_MSG_WIN_CLOSE, &(ucg->arg));
+  }
+  return ucg_pgm_read( (ucg_pgm_uint8_t *)(glyph_data+6) );
+}
+
 /*
   Description:
     Find the starting point of the glyph data.
@@ -721,6 +1007,15 @@ int8_t ucg_font_decode_glyph(ucg_t *ucg, const uint8_t *glyph_data)
 const uint8_t *ucg_font_get_glyph_data(ucg_t *ucg, uint8_t encoding)
 {
   const uint8_t *font = ucg->font;
+  
+  if ( ucg->font_glyph_index != NULL )
+  {
+    /* offset 0 is the font header, so 0 marks a missing glyph */
+    if ( ucg->font_glyph_index[encoding] == 0 )
+      return NULL;
+    return font + ucg->font_glyph_index[encoding];
+  }
+  
   font += UCG_FONT_DATA_STRUCT_SIZE;
   
   if ( encoding >= 'a' )
@@ -755,7 +1050,7 @@ ucg_int_t ucg_font_draw_glyph(ucg_t *ucg, ucg_int_t x, ucg_int_t y, uint8_t dir,
   const uint8_t *glyph_data = ucg_font_get_glyph_data(ucg, encoding);
   if ( glyph_data != NULL )
   {
-    dx = ucg_font_decode_glyph(ucg, glyph_data);
+    dx = ucg->font_decode_glyph(ucg, glyph_data);
   }
   return dx;
 }
@@ -785,6 +1080,9 @@ int8_t ucg_GetGlyphWidth(ucg_t *ucg, uint8_t requested_encoding)
   if ( glyph_data == NULL )
     return 0; 
   
+  if ( ucg->font_info.bbx_mode & UCG_FONT_BBX_MODE_EXPANDED )
+    return ucg_pgm_read( (ucg_pgm_uint8_t *)(glyph_data+6) );
+  
   ucg_font_setup_decode(ucg, glyph_data);
   ucg_font_decode_get_signed_bits(&(ucg->font_decode), ucg->font_info.bits_per_char_x);
   ucg_font_decode_get_signed_bits(&(ucg->font_decode), ucg->font_info.bits_per_char_y);
@@ -959,13 +1257,49 @@ void ucg_SetFontPosCenter(ucg_t *ucg)
 
 /*===============================================*/
 
+/*
+  fill the glyph index of the current font: 
+  each entry is the offset of the glyph data from the start of the font
+*/
+static void ucg_font_build_glyph_index(ucg_t *ucg)
+{
+  const uint8_t *font = ucg->font;
+  uint16_t *glyph_index = ucg->font_glyph_index;
+  uint16_t i;
+  
+  for( i = 0; i < UCG_FONT_GLYPH_INDEX_SIZE; i++ )
+    glyph_index[i] = 0;
+  
+  font += UCG_FONT_DATA_STRUCT_SIZE;
+  for(;;)
+  {
+    if ( ucg_pgm_read( ((ucg_pgm_uint8_t *)font) + 1 ) == 0 )
+      break;
+    glyph_index[ucg_pgm_read( (ucg_pgm_uint8_t *)font )] = font - ucg->font;
+    font += ucg_pgm_read( ((ucg_pgm_uint8_t *)font) + 1 );
+  }
+}
+
+void ucg_SetFontGlyphIndex(ucg_t *ucg, uint16_t *glyph_index)
+{
+  ucg->font_glyph_index = glyph_index;
+  if ( glyph_index != NULL && ucg->font != NULL )
+    ucg_font_build_glyph_index(ucg);
+}
+
 void ucg_SetFont(ucg_t *ucg, const ucg_fntpgm_uint8_t  *font)
 {
   if ( ucg->font != font )
   {
     ucg->font = font;
     ucg_read_font_info(&(ucg->font_info), font);
+    /* select the decoder for the glyph format of the font */
+    ucg->font_decode_glyph = ucg_font_decode_glyph;
+    if ( ucg->font_info.bbx_mode & UCG_FONT_BBX_MODE_EXPANDED )
+      ucg->font_decode_glyph = ucg_font_decode_glyph_expanded;
     ucg_UpdateRefHeight(ucg);
+    if ( ucg->font_glyph_index != NULL )
+      ucg_font_build_glyph_index(ucg);
     //ucg_SetFontPosBaseline(ucg);
   }
 }
@@ -47,16 +47,25 @@ void ucg_init_struct(ucg_t *ucg)
   //memset(ucg, 0, sizeof(ucg_t));
   ucg->is_power_up = 0;
   ucg->rotate_chain_device_cb = 0;
+  ucg->strip_chain_device_cb = 0;
+  ucg->strip = 0;
   ucg->arg.scale = 1;
   //ucg->display_offset.x = 0;
   //ucg->display_offset.y = 0;
   ucg->font = 0;
+  ucg->font_glyph_index = 0;
   //ucg->font_mode = UCG_FONT_MODE_NONE;   Old font procedures
   ucg->font_decode.is_transparent = 1;  // new font procedures
   
   ucg->com_initial_change_sent = 0;
   ucg->com_status = 0;
   ucg->com_cfg_cd = 0;
+  ucg->cmd_seq_fast = 0;
+  ucg->cmd_seq_async = 0;
+  ucg->cmd_seq_delay = 0;
+  ucg->cmd_seq_resume = 0;
+  ucg->hw_rotate = 0;
+  /* xmega_hook is not cleared, the Xmega HAL sets it before ucg_Init() */
 }
 
 
@@ -76,3 +85,31 @@ ucg_int_t ucg_Init(ucg_t *ucg, ucg_dev_fnptr device_cb, ucg_dev_fnptr ext_cb, uc
   return r;
 }
 
+/*
+  Same as ucg_Init(), but the init sequence of the display is not completed:
+  the first UCG_DLY_MS() of the sequence returns from ucg_InitAsync(). The
+  caller waits ucg->cmd_seq_delay milliseconds without blocking and calls
+  ucg_com_ResumeCmdSeq() until it returns 0. Nothing else may be sent to
+  the display before.
+  
+  The init sequence must be the last command sequence of UCG_MSG_DEV_POWER_UP,
+  as it is for the devices of ucglib.
+*/
+ucg_int_t ucg_InitAsync(ucg_t *ucg, ucg_dev_fnptr device_cb, ucg_dev_fnptr ext_cb, ucg_com_fnptr com_cb)
+{
+  ucg_int_t r;
+  ucg_init_struct(ucg);
+  if ( ext_cb == (ucg_dev_fnptr)0 )
+    ucg->ext_cb = ucg_ext_none;
+ else 
+    ucg->ext_cb = ext_cb;
+  ucg->device_cb = device_cb;
+  ucg->com_cb = com_cb;
+  ucg_SetFontPosBaseline(ucg);
+  ucg->cmd_seq_async = 1;
+  r = ucg_PowerUp(ucg);
+  if ( ucg->cmd_seq_resume == NULL )
+    ucg->cmd_seq_async = 0;		/* the sequence had no delay */
+  ucg_GetDimension(ucg);
+  return r;
+}
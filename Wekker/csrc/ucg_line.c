@@ -38,9 +38,7 @@
 
 void ucg_Draw90Line(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t len, ucg_int_t dir, ucg_int_t col_idx)
 {
-  ucg->arg.pixel.rgb.color[0] = ucg->arg.rgb[col_idx].color[0];
-  ucg->arg.pixel.rgb.color[1] = ucg->arg.rgb[col_idx].color[1];
-  ucg->arg.pixel.rgb.color[2] = ucg->arg.rgb[col_idx].color[2];
+  ucg->arg.pixel.rgb = ucg->arg.rgb[col_idx];
   ucg->arg.pixel.pos.x = x;
   ucg->arg.pixel.pos.y = y;
   ucg->arg.len = len;
@@ -73,6 +71,32 @@ void ucg_DrawGradientLine(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t len, u
   ucg_DrawL90SEWithArg(ucg);
 }
 
+/*
+  Bresenham: after k steps in the major direction, the minor position has
+  been changed m(k) times:
+    m(k) = ceil((k*dy - e0) / dx), at least 0, with e0 = dx/2
+  This is used to clip the line against the user clip box without stepping 
+  through the invisible part. The visible part is drawn as runs in the
+  major direction with UCG_MSG_DRAW_L90FX.
+*/
+
+/* first k with m(k) >= m */
+static ucg_int_t ucg_line_first_k(ucg_int_t m, ucg_int_t dx, ucg_int_t dy)
+{
+  if ( m <= 0 )
+    return 0;
+  return ((int32_t)(m-1)*dx + (dx>>1)) / dy + 1;
+}
+
+/* last k with m(k) <= m */
+static ucg_int_t ucg_line_last_k(ucg_int_t m, ucg_int_t dx, ucg_int_t dy)
+{
+  int32_t k = ((int32_t)m*dx + (dx>>1)) / dy;
+  if ( k > dx )
+    return dx;
+  return k;
+}
+
 void ucg_DrawLine(ucg_t *ucg, ucg_int_t x1, ucg_int_t y1, ucg_int_t x2, ucg_int_t y2)
 {
   ucg_int_t tmp;
@@ -80,14 +104,24 @@ void ucg_DrawLine(ucg_t *ucg, ucg_int_t x1, ucg_int_t y1, ucg_int_t x2, ucg_int_
   ucg_int_t dx, dy;
   ucg_int_t err;
   ucg_int_t ystep;
+  ucg_int_t cx0, cx1, cy0, cy1;		/* clip range, swapped like x and y */
+  ucg_int_t k0, k1, k;
+  ucg_int_t run_x;
+  int32_t m;
 
   uint8_t swapxy = 0;
   
-  /* no BBX intersection check at the moment... */
-
-  ucg->arg.pixel.rgb.color[0] = ucg->arg.rgb[0].color[0];
-  ucg->arg.pixel.rgb.color[1] = ucg->arg.rgb[0].color[1];
-  ucg->arg.pixel.rgb.color[2] = ucg->arg.rgb[0].color[2];
+  /* trivial reject against the bounding box */
+  cx0 = ucg->user_clip_box.ul.x;
+  cx1 = cx0 + ucg->user_clip_box.size.w - 1;
+  cy0 = ucg->user_clip_box.ul.y;
+  cy1 = cy0 + ucg->user_clip_box.size.h - 1;
+  if ( x1 < cx0 && x2 < cx0 ) return;
+  if ( x1 > cx1 && x2 > cx1 ) return;
+  if ( y1 < cy0 && y2 < cy0 ) return;
+  if ( y1 > cy1 && y2 > cy1 ) return;
+
+  ucg->arg.pixel.rgb = ucg->arg.rgb[0];
     
   if ( x1 > x2 ) dx = x1-x2; else dx = x2-x1;
   if ( y1 > y2 ) dy = y1-y2; else dy = y2-y1;
@@ -98,34 +132,83 @@ void ucg_DrawLine(ucg_t *ucg, ucg_int_t x1, ucg_int_t y1, ucg_int_t x2, ucg_int_
     tmp = dx; dx =dy; dy = tmp;
     tmp = x1; x1 =y1; y1 = tmp;
     tmp = x2; x2 =y2; y2 = tmp;
+    tmp = cx0; cx0 = cy0; cy0 = tmp;
+    tmp = cx1; cx1 = cy1; cy1 = tmp;
   }
   if ( x1 > x2 ) 
   {
     tmp = x1; x1 =x2; x2 = tmp;
     tmp = y1; y1 =y2; y2 = tmp;
   }
-  err = dx >> 1;
   if ( y2 > y1 ) ystep = 1; else ystep = -1;
-  y = y1;
-  for( x = x1; x <= x2; x++ )
+  
+  /* clip the major direction */
+  k0 = 0;
+  k1 = dx;
+  if ( x1 < cx0 ) k0 = cx0 - x1;
+  if ( x2 > cx1 ) k1 = cx1 - x1;
+  
+  /* clip the minor direction: m(k) must be inside the clip range */
+  if ( dy != 0 )
   {
-    if ( swapxy == 0 ) 
+    if ( ystep > 0 )
     {
-      ucg->arg.pixel.pos.x = x;
-      ucg->arg.pixel.pos.y = y;
+      tmp = ucg_line_first_k(cy0 - y1, dx, dy);
+      if ( k0 < tmp ) k0 = tmp;
+      if ( cy1 - y1 < dy ) 
+      {
+	tmp = ucg_line_last_k(cy1 - y1, dx, dy);
+	if ( k1 > tmp ) k1 = tmp;
+      }
     }
-    else 
+    else
     {
-      ucg->arg.pixel.pos.x = y;
-      ucg->arg.pixel.pos.y = x;
+      tmp = ucg_line_first_k(y1 - cy1, dx, dy);
+      if ( k0 < tmp ) k0 = tmp;
+      if ( y1 - cy0 < dy ) 
+      {
+	tmp = ucg_line_last_k(y1 - cy0, dx, dy);
+	if ( k1 > tmp ) k1 = tmp;
+      }
+    }
+  }
+  if ( k0 > k1 )
+    return;
+  
+  /* Bresenham state at k0 */
+  m = 0;
+  if ( (int32_t)k0*dy > (dx>>1) )
+    m = ((int32_t)k0*dy - (dx>>1) + dx - 1) / dx;
+  err = (dx>>1) - (int32_t)k0*dy + m*dx;
+  y = y1 + ystep*(ucg_int_t)m;
+  
+  run_x = x1 + k0;
+  for( k = k0; k <= k1; k++ )
+  {
+    x = x1 + k;
+    err -= dy;
+    if ( err < 0 || k == k1 ) 
+    {
+      /* last pixel of a run */
+      if ( swapxy == 0 ) 
+      {
+	ucg->arg.pixel.pos.x = run_x;
+	ucg->arg.pixel.pos.y = y;
+      }
+      else 
+      {
+	ucg->arg.pixel.pos.x = y;
+	ucg->arg.pixel.pos.y = run_x;
+      }
+      ucg->arg.len = x - run_x + 1;
+      ucg->arg.dir = swapxy;		/* runs in x (dir 0) or y (dir 1) direction, the callbacks modify arg */
+      ucg_DrawL90FXWithArg(ucg);
+      run_x = x + 1;
     }
-    ucg_DrawPixelWithArg(ucg);  
-    err -= (uint8_t)dy;
     if ( err < 0 ) 
     {
       y += ystep;
       err += dx;
     }
   }
-
 }
@@ -43,14 +43,24 @@ void ucg_SetColor(ucg_t *ucg, uint8_t idx, uint8_t r, uint8_t g, uint8_t b)
   ucg->arg.rgb[idx].color[0] = r;
   ucg->arg.rgb[idx].color[1] = g;
   ucg->arg.rgb[idx].color[2] = b;
+#if UCG_COLOR_565
+  ucg_color_Set565(ucg->arg.rgb+idx);
+#endif
 }
 
+#if UCG_COLOR_565
+/* calculate the RGB565 value from the 8 bit color components */
+void ucg_color_Set565(ucg_color_t *c)
+{
+  c->rgb565[0] = (c->color[0] & 0x0f8) | (c->color[1] >> 5);
+  c->rgb565[1] = ((c->color[1] << 3) & 0x0e0) | (c->color[2] >> 3);
+}
+#endif
+
 
 void ucg_DrawPixel(ucg_t *ucg, ucg_int_t x, ucg_int_t y)
 {
-  ucg->arg.pixel.rgb.color[0] = ucg->arg.rgb[0].color[0];
-  ucg->arg.pixel.rgb.color[1] = ucg->arg.rgb[0].color[1];
-  ucg->arg.pixel.rgb.color[2] = ucg->arg.rgb[0].color[2];
+  ucg->arg.pixel.rgb = ucg->arg.rgb[0];
   
   ucg->arg.pixel.pos.x = x;
   ucg->arg.pixel.pos.y = y;
@@ -201,7 +201,7 @@ static void pg_hline(pg_struct *pg, ucg_t *ucg)
       x1 = 0;
     if ( x2 >= ucg_GetWidth(ucg) )
       x2 = ucg_GetWidth(ucg);
-    ucg_DrawHLine(ucg, x1, y, x2 - x1);
+    ucg_span_add(ucg, &(pg->span), x1, y, x2 - x1);
   }
   else
   {
@@ -213,7 +213,7 @@ static void pg_hline(pg_struct *pg, ucg_t *ucg)
       x1 = 0;
     if ( x1 >= ucg_GetWidth(ucg) )
       x1 = ucg_GetWidth(ucg);
-    ucg_DrawHLine(ucg, x2, y, x1 - x2);
+    ucg_span_add(ucg, &(pg->span), x2, y, x1 - x2);
   }
 }
 
@@ -240,6 +240,7 @@ static void pg_line_init(pg_struct * pg, uint8_t pge_index)
 static void pg_exec(pg_struct *pg, ucg_t *ucg)
 {
   pg_word_t i = pg->total_scan_line_cnt;
+  uint8_t is_batch;
 
   /* first line is skipped if the min y line is not flat */
   pg_line_init(pg, PG_LEFT);		
@@ -251,6 +252,9 @@ static void pg_exec(pg_struct *pg, ucg_t *ucg)
     pge_Next(&(pg->pge[PG_RIGHT]));
   }
 
+  /* all spans of the polygon are sent in one transaction */
+  ucg_span_init(ucg, &(pg->span));
+  is_batch = ucg_com_BeginBatch(ucg);
   do
   {
     pg_hline(pg, ucg);
@@ -264,6 +268,9 @@ static void pg_exec(pg_struct *pg, ucg_t *ucg)
     }
     i--;
   } while( i > 0 );
+  ucg_span_flush(ucg, &(pg->span));
+  if ( is_batch != 0 )
+    ucg_com_EndBatch(ucg);
 }
 
 /*===========================================*/
@@ -46,6 +46,11 @@ void ucg_UndoRotate(ucg_t *ucg)
     ucg->device_cb = ucg->rotate_chain_device_cb;
     ucg->rotate_chain_device_cb = NULL;
   }
+  if ( ucg->hw_rotate != 0 )
+  {
+    uint8_t rotation = 0;
+    ucg->device_cb(ucg, UCG_MSG_SET_HW_ROTATE, &rotation);
+  }
   ucg_GetDimension(ucg);
   ucg_SetMaxClipRange(ucg);
 }
@@ -105,6 +110,8 @@ ucg_int_t ucg_dev_rotate90(ucg_t *ucg, ucg_int_t msg, void *data)
     case UCG_MSG_DRAW_L90BF:
 #endif /* UCG_MSG_DRAW_L90BF */
     case UCG_MSG_DRAW_L90SE:
+    case UCG_MSG_WIN_OPEN:
+    case UCG_MSG_DRAW_BOX:
     //case UCG_MSG_DRAW_L90RL:
       ucg->arg.dir+=1;
       ucg->arg.dir&=3;
@@ -170,6 +177,8 @@ ucg_int_t ucg_dev_rotate180(ucg_t *ucg, ucg_int_t msg, void *data)
     case UCG_MSG_DRAW_L90BF:
 #endif /* UCG_MSG_DRAW_L90BF */
     case UCG_MSG_DRAW_L90SE:
+    case UCG_MSG_WIN_OPEN:
+    case UCG_MSG_DRAW_BOX:
     //case UCG_MSG_DRAW_L90RL:
       ucg->arg.dir+=2;
       ucg->arg.dir&=3;
@@ -235,6 +244,8 @@ ucg_int_t ucg_dev_rotate270(ucg_t *ucg, ucg_int_t msg, void *data)
     case UCG_MSG_DRAW_L90BF:
 #endif /* UCG_MSG_DRAW_L90BF */
     case UCG_MSG_DRAW_L90SE:
+    case UCG_MSG_WIN_OPEN:
+    case UCG_MSG_DRAW_BOX:
 //    case UCG_MSG_DRAW_L90RL:
       ucg->arg.dir+=3;
       ucg->arg.dir&=3;
@@ -254,3 +265,30 @@ void ucg_SetRotate270(ucg_t *ucg)
   ucg_SetMaxClipRange(ucg);
 }
 
+/*================================================*/
+/* rotation by the controller */
+
+/* 
+  rotation: 0..3 for 0, 90, 180 and 270 degree, same orientation as ucg_SetRotate90() etc.
+  If the device does not support UCG_MSG_SET_HW_ROTATE, the rotation callbacks are used.
+  Side-Effects: Update dimension and reset clip range to max 
+*/
+void ucg_SetHwRotate(ucg_t *ucg, uint8_t rotation)
+{
+  ucg_UndoRotate(ucg);
+  rotation &= 3;
+  if ( rotation == 0 )
+    return;
+  if ( ucg->device_cb(ucg, UCG_MSG_SET_HW_ROTATE, &rotation) == 0 )
+  {
+    switch(rotation)
+    {
+      case 1: ucg_SetRotate90(ucg); break;
+      case 2: ucg_SetRotate180(ucg); break;
+      default: ucg_SetRotate270(ucg); break;
+    }
+    return;
+  }
+  ucg_GetDimension(ucg);
+  ucg_SetMaxClipRange(ucg);
+}
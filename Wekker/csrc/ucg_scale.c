@@ -211,6 +211,10 @@ ucg_int_t ucg_dev_scale2x2(ucg_t *ucg, ucg_int_t msg, void *data)
       ucg->arg.dir = dir;
       return 1;
 #endif 
+    case UCG_MSG_WIN_OPEN:
+    case UCG_MSG_DRAW_BOX:
+      /* windows are not scaled, let the caller use the l90 messages */
+      return 0;
   }
   return ucg->scale_chain_device_cb(ucg, msg, data);  
 }
@@ -0,0 +1,358 @@
+/*
+
+  ucg_strip.c
+
+  Universal uC Color Graphics Library
+
+  Copyright (c) 2014, olikraus@gmail.com
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list
+    of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice, this
+    list of conditions and the following disclaimer in the documentation and/or other
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+  Strip device: Render into a RAM buffer with some lines of the display
+  and send each finished strip with one window to the display.
+
+  static uint16_t buf[160*16];
+  static ucg_strip_t strip;
+
+  ucg_SetRotate90(&ucg);		rotation (also ucg_SetHwRotate()) and scaling must be set before the strip
+  ucg_SetStrip(&ucg, &strip, buf, 16);
+
+  ucg_FirstStrip(&ucg);
+  do
+  {
+    ... draw the complete screen ...
+  } while( ucg_NextStrip(&ucg) );
+
+  Each strip starts black. Pixels are stored as RGB565. Outside of the
+  FirstStrip/NextStrip loop, all messages are sent directly to the display.
+
+*/
+
+#include "ucg.h"
+#include <string.h>
+
+static uint16_t ucg_strip_get_565(const ucg_color_t *c)
+{
+#if UCG_COLOR_565
+  return ((uint16_t)c->rgb565[0] << 8) | c->rgb565[1];
+#else
+  uint16_t v;
+  v = c->color[0] >> 3;
+  v <<= 6;
+  v |= c->color[1] >> 2;
+  v <<= 5;
+  v |= c->color[2] >> 3;
+  return v;
+#endif
+}
+
+static void ucg_strip_set_rgb(ucg_color_t *c, uint16_t v)
+{
+  uint8_t b;
+  b = (v >> 8) & 0x0f8;
+  c->color[0] = b | (b >> 5);
+  b = (v >> 3) & 0x0fc;
+  c->color[1] = b | (b >> 6);
+  b = (v << 3) & 0x0f8;
+  c->color[2] = b | (b >> 5);
+#if UCG_COLOR_565
+  c->rgb565[0] = v >> 8;
+  c->rgb565[1] = v & 255;
+#endif
+}
+
+/* intersect the clip box of the user with the current strip */
+static void ucg_strip_set_clip_box(ucg_strip_t *strip)
+{
+  ucg_int_t y0, y1;
+
+  strip->clip_box.ul.x = strip->user_clip_box.ul.x;
+  strip->clip_box.size.w = strip->user_clip_box.size.w;
+  y0 = strip->user_clip_box.ul.y;
+  y1 = y0 + strip->user_clip_box.size.h;
+  if ( y0 < strip->y )
+    y0 = strip->y;
+  if ( y1 > strip->y + strip->lines )
+    y1 = strip->y + strip->lines;
+  if ( y1 < y0 )
+    y1 = y0;
+  strip->clip_box.ul.y = y0;
+  strip->clip_box.size.h = y1 - y0;
+}
+
+static uint8_t ucg_strip_is_visible(ucg_strip_t *strip, ucg_int_t x, ucg_int_t y)
+{
+  if ( x < strip->clip_box.ul.x || x >= strip->clip_box.ul.x + strip->clip_box.size.w )
+    return 0;
+  if ( y < strip->clip_box.ul.y || y >= strip->clip_box.ul.y + strip->clip_box.size.h )
+    return 0;
+  return 1;
+}
+
+/* dev_cb for the ucg_handle_l90xx procedures: pixel is already clipped */
+static ucg_int_t ucg_strip_draw_pixel(ucg_t *ucg, ucg_int_t msg, void *data)
+{
+  ucg_strip_t *strip = ucg->strip;
+  strip->buf[(ucg->arg.pixel.pos.y - strip->y)*strip->w + ucg->arg.pixel.pos.x] = ucg_strip_get_565(&(ucg->arg.pixel.rgb));
+  return 1;
+}
+
+/* draw the next ucg->arg.len pixel of the window */
+static void ucg_strip_win_run(ucg_t *ucg)
+{
+  ucg_strip_t *strip = ucg->strip;
+  ucg_int_t len = ucg->arg.len;
+  ucg_int_t x, y;
+  uint16_t c = ucg_strip_get_565(&(ucg->arg.pixel.rgb));
+
+  while( len > 0 )
+  {
+    switch(strip->win_dir)
+    {
+      case 0: x = strip->win_pos.x + strip->win_x; y = strip->win_pos.y + strip->win_y; break;
+      case 1: x = strip->win_pos.x - strip->win_y; y = strip->win_pos.y + strip->win_x; break;
+      case 2: x = strip->win_pos.x - strip->win_x; y = strip->win_pos.y - strip->win_y; break;
+      default: case 3: x = strip->win_pos.x + strip->win_y; y = strip->win_pos.y - strip->win_x; break;
+    }
+    if ( ucg_strip_is_visible(strip, x, y) != 0 )
+      strip->buf[(y - strip->y)*strip->w + x] = c;
+    strip->win_x++;
+    if ( strip->win_x >= strip->win_len )
+    {
+      strip->win_x = 0;
+      strip->win_y++;
+    }
+    len--;
+  }
+}
+
+ucg_int_t ucg_dev_strip(ucg_t *ucg, ucg_int_t msg, void *data)
+{
+  ucg_strip_t *strip = ucg->strip;
+  ucg_box_t box;
+  ucg_int_t r;
+
+  if ( msg == UCG_MSG_SET_CLIP_BOX )
+  {
+    /* the box is modified by a rotation device, keep a copy */
+    strip->user_clip_box = *(ucg_box_t *)data;
+    ucg_strip_set_clip_box(strip);
+  }
+  else if ( strip->is_active != 0 )
+  {
+    switch(msg)
+    {
+      case UCG_MSG_DRAW_PIXEL:
+	if ( ucg_strip_is_visible(strip, ucg->arg.pixel.pos.x, ucg->arg.pixel.pos.y) != 0 )
+	  ucg_strip_draw_pixel(ucg, msg, data);
+	return 1;
+      case UCG_MSG_DRAW_L90FX:
+      case UCG_MSG_DRAW_L90SE:
+#ifdef UCG_MSG_DRAW_L90TC
+      case UCG_MSG_DRAW_L90TC:
+#endif /* UCG_MSG_DRAW_L90TC */
+#ifdef UCG_MSG_DRAW_L90BF
+      case UCG_MSG_DRAW_L90BF:
+#endif /* UCG_MSG_DRAW_L90BF */
+	/* the generic handlers clip against ucg->clip_box, which is the clip box of the display */
+	box = ucg->clip_box;
+	ucg->clip_box = strip->clip_box;
+	switch(msg)
+	{
+#ifdef UCG_MSG_DRAW_L90TC
+	  case UCG_MSG_DRAW_L90TC:
+	    r = ucg_handle_l90tc(ucg, ucg_strip_draw_pixel);
+	    break;
+#endif /* UCG_MSG_DRAW_L90TC */
+#ifdef UCG_MSG_DRAW_L90BF
+	  case UCG_MSG_DRAW_L90BF:
+	    r = ucg_handle_l90bf(ucg, ucg_strip_draw_pixel);
+	    break;
+#endif /* UCG_MSG_DRAW_L90BF */
+	  case UCG_MSG_DRAW_L90SE:
+	    r = ucg_handle_l90se(ucg, ucg_strip_draw_pixel);
+	    break;
+	  default:
+	    r = ucg_handle_l90fx(ucg, ucg_strip_draw_pixel);
+	    break;
+	}
+	ucg->clip_box = box;
+	return r;
+      case UCG_MSG_WIN_OPEN:
+	strip->win_pos = ucg->arg.pixel.pos;
+	strip->win_len = ucg->arg.len;
+	strip->win_dir = ucg->arg.dir;
+	strip->win_x = 0;
+	strip->win_y = 0;
+	return 1;
+      case UCG_MSG_WIN_RUN:
+	ucg_strip_win_run(ucg);
+	return 1;
+      case UCG_MSG_WIN_CLOSE:
+	return 1;
+      case UCG_MSG_DRAW_BOX:
+	/* clip the window against the strip and fill it as one run */
+	box = ucg->clip_box;
+	ucg->clip_box = strip->clip_box;
+	r = ucg_clip_win(ucg);
+	ucg->clip_box = box;
+	if ( r != 0 )
+	{
+	  strip->win_pos = ucg->arg.pixel.pos;
+	  strip->win_len = ucg->arg.len;
+	  strip->win_dir = ucg->arg.dir;
+	  strip->win_x = 0;
+	  strip->win_y = 0;
+	  ucg->arg.len *= ucg->arg.lines;
+	  ucg_strip_win_run(ucg);
+	}
+	return 1;
+    }
+  }
+  return ucg->strip_chain_device_cb(ucg, msg, data);
+}
+
+/* send the current strip to the display, use one window if possible */
+static void ucg_strip_flush(ucg_t *ucg)
+{
+  ucg_strip_t *strip = ucg->strip;
+  uint16_t *p = strip->buf;
+  uint16_t *end = p + strip->w*strip->lines;
+  ucg_int_t x, y, len;
+
+  ucg->arg.pixel.pos.x = 0;
+  ucg->arg.pixel.pos.y = strip->y;
+  ucg->arg.len = strip->w;
+  ucg->arg.lines = strip->lines;
+  ucg->arg.dir = 0;
+  if ( ucg->strip_chain_device_cb(ucg, UCG_MSG_WIN_OPEN, &(ucg->arg)) != 0 )
+  {
+    /* runs of the same color may continue on the next line of the window */
+    while( p < end )
+    {
+      len = 1;
+      while( p+len < end && p[len] == *p )
+	len++;
+      ucg_strip_set_rgb(&(ucg->arg.pixel.rgb), *p);
+      ucg->arg.len = len;
+      ucg->strip_chain_device_cb(ucg, UCG_MSG_WIN_RUN, &(ucg->arg));
+      p += len;
+    }
+    ucg->strip_chain_device_cb(ucg, UCG_MSG_WIN_CLOSE, &(ucg->arg));
+  }
+  else
+  {
+    for( y = 0; y < strip->lines; y++ )
+    {
+      x = 0;
+      while( x < strip->w )
+      {
+	len = 1;
+	while( x+len < strip->w && p[len] == *p )
+	  len++;
+	ucg_strip_set_rgb(&(ucg->arg.pixel.rgb), *p);
+	ucg->arg.pixel.pos.x = x;
+	ucg->arg.pixel.pos.y = strip->y + y;
+	ucg->arg.len = len;
+	ucg->arg.dir = 0;
+	ucg->strip_chain_device_cb(ucg, UCG_MSG_DRAW_L90FX, &(ucg->arg));
+	p += len;
+	x += len;
+      }
+    }
+  }
+}
+
+static void ucg_strip_start(ucg_t *ucg, ucg_int_t y)
+{
+  ucg_strip_t *strip = ucg->strip;
+  strip->y = y;
+  strip->lines = ucg->dimension.h - y;
+  if ( strip->lines > strip->h )
+    strip->lines = strip->h;
+  memset(strip->buf, 0, (size_t)strip->w*(size_t)strip->lines*sizeof(uint16_t));
+  ucg_strip_set_clip_box(strip);
+  strip->is_active = 1;
+}
+
+void ucg_UndoStrip(ucg_t *ucg)
+{
+  if ( ucg->strip_chain_device_cb != NULL )
+  {
+    ucg->device_cb = ucg->strip_chain_device_cb;
+    ucg->strip_chain_device_cb = NULL;
+  }
+  ucg->strip = NULL;
+  ucg_GetDimension(ucg);
+  ucg_SetMaxClipRange(ucg);
+}
+
+/*
+  buf must have space for h lines of the display: width*h uint16_t
+  Side-Effects: Update dimension and reset clip range to max
+*/
+void ucg_SetStrip(ucg_t *ucg, ucg_strip_t *strip, uint16_t *buf, ucg_int_t h)
+{
+  ucg_UndoStrip(ucg);
+  strip->buf = buf;
+  strip->w = ucg->dimension.w;
+  strip->h = h;
+  strip->y = 0;
+  strip->lines = 0;
+  strip->is_active = 0;
+  ucg->strip = strip;
+  ucg->strip_chain_device_cb = ucg->device_cb;
+  ucg->device_cb = ucg_dev_strip;
+  ucg_GetDimension(ucg);
+  ucg_SetMaxClipRange(ucg);
+}
+
+void ucg_FirstStrip(ucg_t *ucg)
+{
+  if ( ucg->strip == NULL )
+    return;
+  ucg_strip_start(ucg, 0);
+}
+
+/*
+  send the current strip to the display and start the next strip
+  return 0 if the last strip has been sent
+*/
+uint8_t ucg_NextStrip(ucg_t *ucg)
+{
+  ucg_strip_t *strip = ucg->strip;
+  if ( strip == NULL || strip->is_active == 0 )
+    return 0;
+  ucg_strip_flush(ucg);
+  if ( strip->y + strip->lines >= ucg->dimension.h )
+  {
+    strip->is_active = 0;
+    return 0;
+  }
+  ucg_strip_start(ucg, strip->y + strip->lines);
+  return 1;
+}
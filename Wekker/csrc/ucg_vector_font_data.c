@@ -0,0 +1,1471 @@
+#include "ucg.h"
+/*
+  Fonts used by the Alarm firmware (main.c).
+  The data has been taken from the Alarm firmware image (Debug/Alarm.elf),
+  the original font file was not part of the source tree.
+*/
+/*
+  Fontname: fur11_hf
+  Glyphs: 189
+  BBX Build Mode: 1
+*/
+const ucg_fntpgm_uint8_t ucg_font_fur11_hf[3934] UCG_FONT_SECTION("ucg_font_fur11_hf") = {
+  189,1,4,2,4,5,1,3,5,15,20,255,252,11,253,11,
+  253,2,103,5,16,32,7,69,163,62,159,2,33,11,69,163,
+  62,56,212,95,230,113,0,34,16,71,227,62,153,66,162,144,
+  68,36,17,73,61,199,0,35,29,75,99,63,7,145,92,36,
+  22,17,13,6,170,72,44,34,26,12,84,145,152,36,22,201,
+  69,242,140,0,36,31,73,35,63,69,48,54,8,69,18,153,
+  72,34,19,73,13,98,3,89,66,21,233,68,145,208,12,100,
+  121,10,0,37,34,78,195,63,199,163,84,68,147,202,68,98,
+  153,72,44,162,8,46,34,195,132,89,36,19,139,100,82,153,
+  136,42,180,103,13,38,27,75,99,63,235,93,38,150,137,13,
+  114,155,140,66,146,41,201,100,6,153,144,205,104,160,208,51,
+  39,11,70,195,62,137,40,213,158,27,0,40,14,70,195,62,
+  77,42,36,74,245,43,85,33,0,41,13,69,163,62,56,84,
+  36,234,27,77,168,14,42,15,74,67,63,55,145,156,108,48,
+  211,13,242,124,3,43,14,79,227,63,191,139,55,29,156,198,
+  219,115,7,44,10,68,131,62,99,137,36,19,5,45,10,70,
+  195,62,215,131,60,53,0,46,9,68,131,62,235,76,30,2,
+  47,15,70,195,62,81,170,40,85,148,106,148,202,227,0,48,
+  27,72,3,63,241,32,35,201,100,36,161,72,40,18,138,132,
+  34,161,72,70,34,9,13,242,68,0,49,13,72,3,63,185,
+  106,164,200,245,247,68,0,50,19,72,3,63,241,32,35,177,
+  201,197,84,178,152,202,108,176,167,1,51,22,72,3,63,241,
+  32,147,81,136,98,34,97,78,151,16,69,50,154,65,158,8,
+  52,22,72,3,63,3,213,42,17,138,100,36,153,18,77,100,
+  48,136,229,234,105,0,53,21,72,3,63,237,64,147,171,216,
+  72,36,161,92,73,70,34,9,237,169,0,54,27,72,3,63,
+  245,32,162,81,132,20,185,196,32,162,81,164,18,169,68,42,
+  161,209,12,242,52,0,55,17,72,3,63,237,96,16,51,139,
+  201,98,102,49,123,42,0,56,24,72,3,63,241,32,35,145,
+  132,34,54,35,73,38,20,9,69,66,17,155,65,158,8,57,
+  26,72,3,63,241,64,162,81,164,18,169,132,70,50,72,228,
+  98,138,144,66,162,25,228,137,0,58,12,68,131,62,81,38,
+  15,202,228,33,0,59,12,68,131,62,81,38,15,138,152,68,
+  1,60,18,79,227,63,191,13,75,167,226,60,96,15,216,3,
+  244,188,1,61,14,79,227,63,255,102,112,79,54,184,231,55,
+  0,62,19,79,227,63,191,201,3,244,128,61,64,15,200,46,
+  167,122,158,2,63,17,72,3,63,241,32,162,209,197,100,237,
+  234,1,121,50,0,64,39,79,227,63,175,6,66,149,97,70,
+  178,136,100,34,78,138,50,145,162,76,164,40,19,169,145,72,
+  34,38,25,201,68,37,215,3,6,122,20,0,65,26,75,99,
+  63,7,194,97,34,167,144,73,82,26,145,70,52,24,72,84,
+  146,92,66,167,39,7,66,28,74,67,63,179,193,40,164,73,
+  101,82,153,144,102,48,74,101,98,145,88,36,37,25,12,242,
+  196,0,67,20,74,67,63,195,129,72,35,81,69,146,93,170,
+  50,33,209,64,79,12,68,27,74,67,63,179,129,42,164,73,
+  101,82,146,88,36,22,137,69,82,146,84,38,164,25,232,201,
+  1,69,17,73,35,63,139,193,38,216,112,176,9,54,28,236,
+  9,1,70,15,72,3,63,237,96,146,107,55,152,228,186,39,
+  4,71,25,75,99,63,243,65,74,36,145,69,162,69,131,72,
+  46,146,139,200,50,170,208,96,144,103,72,27,74,67,63,179,
+  146,88,36,22,137,69,98,145,193,64,18,139,196,34,177,72,
+  44,18,203,211,2,73,9,67,99,62,34,210,127,13,74,15,
+  72,3,63,139,92,63,9,69,50,154,65,158,8,75,25,73,
+  35,63,139,144,36,163,137,136,18,170,217,44,161,138,136,50,
+  154,144,36,165,39,3,76,11,71,227,62,89,255,217,96,143,
+  6,77,37,77,163,63,103,58,201,106,178,74,68,18,33,69,
+  36,161,81,68,106,34,77,36,37,138,76,36,147,200,68,50,
+  155,72,168,158,33,0,78,31,74,67,63,51,85,100,20,25,
+  69,18,154,72,66,19,137,72,106,34,53,138,72,40,17,9,
+  77,82,122,90,0,79,26,75,99,63,235,129,74,99,37,137,
+  73,114,145,92,36,23,137,73,84,33,141,106,160,103,2,80,
+  20,73,35,63,139,193,38,36,73,69,82,145,144,100,176,9,
+  118,79,13,81,28,76,131,63,55,3,153,70,164,210,196,52,
+  185,76,46,147,203,196,52,42,145,70,54,24,232,25,1,82,
+  26,73,35,63,139,193,38,36,73,69,82,145,144,100,32,170,
+  9,73,66,146,84,36,149,167,3,83,24,74,67,63,195,65,
+  72,148,73,73,146,131,220,96,184,140,196,34,34,205,64,79,
+  13,84,12,75,99,63,219,193,89,180,127,207,8,85,26,74,
+  67,63,179,146,88,36,22,137,69,98,145,88,36,22,137,69,
+  82,18,81,106,144,167,6,86,24,74,67,63,43,89,36,37,
+  17,73,68,53,34,137,42,18,75,200,6,57,161,158,28,87,
+  39,79,227,63,15,68,170,72,104,35,9,109,36,22,153,80,
+  68,145,9,69,34,10,145,34,147,72,13,50,137,152,40,17,
+  19,205,84,121,142,0,88,24,75,99,63,91,85,72,163,138,
+  200,20,193,161,112,144,139,168,52,33,155,152,158,1,89,19,
+  74,67,63,51,149,36,149,49,138,168,20,185,97,178,123,114,
+  0,90,19,74,67,63,187,193,32,168,19,234,236,118,118,7,
+  3,61,45,0,91,11,70,195,62,201,38,213,255,106,7,92,
+  15,70,195,62,69,170,44,85,150,106,150,202,131,0,93,11,
+  70,195,62,197,170,255,155,33,0,94,24,79,227,63,223,197,
+  211,137,112,34,27,201,102,162,153,100,42,152,10,166,242,28,
+  1,95,11,72,3,63,255,98,48,208,35,0,96,9,67,99,
+  114,68,146,39,5,97,21,72,3,63,103,131,140,68,151,25,
+  72,52,145,80,36,163,89,228,105,0,98,22,73,35,63,139,
+  96,139,65,198,36,36,73,69,82,145,144,68,83,177,167,4,
+  99,19,72,3,63,103,131,140,68,18,138,228,138,34,54,131,
+  60,17,0,100,24,73,35,63,187,96,205,32,17,209,72,66,
+  146,84,36,21,9,73,52,162,69,158,14,101,20,72,3,63,
+  103,131,140,38,18,138,12,38,185,80,196,102,144,39,2,102,
+  14,71,227,62,225,40,22,26,136,98,125,79,1,103,27,73,
+  35,63,231,131,68,68,35,9,73,82,145,84,36,36,209,104,
+  6,137,156,68,163,25,132,1,104,23,72,3,63,109,174,197,
+  70,34,9,69,66,145,80,36,20,9,69,66,121,26,0,105,
+  10,67,99,62,34,24,233,215,0,106,11,68,131,62,46,155,
+  233,159,168,0,107,20,71,227,62,89,55,145,154,68,104,148,
+  8,37,52,17,73,70,143,6,108,9,67,99,62,34,210,127,
+  13,109,25,77,163,63,63,72,76,54,146,137,36,84,18,42,
+  9,149,132,74,66,37,161,122,134,0,110,22,72,3,63,87,
+  137,141,68,18,138,132,34,161,72,40,18,138,132,242,52,0,
+  111,21,73,35,63,231,131,144,166,72,146,138,164,34,33,137,
+  38,52,200,83,2,112,25,73,35,63,215,137,65,198,36,36,
+  73,69,82,145,144,68,35,73,12,50,193,122,4,0,113,24,
+  73,35,63,231,131,68,68,35,9,73,82,145,84,36,36,209,
+  104,6,137,96,83,0,114,12,69,163,62,237,32,161,9,245,
+  30,8,115,19,72,3,63,103,131,76,70,146,27,228,118,145,
+  140,102,144,39,2,116,14,70,195,62,101,42,51,8,165,122,
+  165,135,2,117,21,72,3,63,87,161,72,40,18,138,132,34,
+  161,72,40,98,179,200,211,0,118,19,72,3,63,71,22,161,
+  136,77,36,20,9,13,82,50,61,21,0,119,28,76,131,63,
+  159,105,44,50,22,145,65,36,162,136,212,36,34,9,77,34,
+  50,218,168,66,122,86,0,120,19,72,3,63,87,154,18,205,
+  32,37,83,13,50,18,73,72,79,2,121,19,72,3,63,71,
+  22,161,136,77,68,163,8,13,82,50,179,152,24,122,16,71,
+  227,62,227,129,74,85,165,74,169,6,122,56,0,123,15,71,
+  227,62,165,72,21,107,37,146,201,58,179,0,124,10,70,195,
+  62,56,213,255,79,0,125,14,71,227,62,153,89,103,70,170,
+  88,43,145,8,126,12,72,3,63,207,39,131,200,158,49,0,
+  160,7,69,163,62,159,2,161,10,69,163,62,113,60,212,239,
+  0,162,25,72,3,63,195,92,104,144,81,76,42,34,69,137,
+  84,34,18,89,104,6,161,92,30,6,163,19,73,35,63,155,
+  65,72,162,9,230,6,170,96,119,131,65,158,14,164,22,74,
+  67,63,179,154,132,34,21,73,133,122,21,73,37,20,153,88,
+  158,11,0,165,20,73,35,63,139,84,68,163,41,57,74,196,
+  54,131,129,42,216,158,20,166,12,70,195,62,77,170,247,144,
+  84,15,1,167,25,71,227,62,221,32,146,137,196,100,27,133,
+  36,19,137,72,6,41,153,44,37,25,36,1,168,9,68,131,
+  62,42,146,103,11,169,36,77,163,63,151,3,217,96,160,154,
+  40,50,163,132,36,145,139,36,114,145,68,40,82,33,81,104,
+  18,131,72,72,149,27,232,217,2,170,17,70,195,62,201,164,
+  100,16,105,33,81,228,6,123,98,0,171,18,72,3,63,15,
+  34,153,72,70,161,81,136,34,169,72,158,22,172,12,74,67,
+  63,95,12,6,202,122,158,1,174,36,77,163,63,151,3,217,
+  96,160,74,100,18,25,69,38,33,137,12,50,145,18,73,155,
+  72,68,145,73,104,114,33,187,129,158,45,0,175,9,68,131,
+  62,106,144,103,11,176,13,69,163,62,118,146,136,36,34,123,
+  182,0,177,17,79,227,63,223,197,75,7,167,241,122,210,193,
+  61,55,0,178,13,70,195,62,201,164,72,99,52,200,51,5,
+  179,16,70,195,62,197,32,33,9,105,36,153,200,158,45,0,
+  180,9,68,131,62,70,82,207,18,182,35,73,35,63,147,193,
+  100,144,200,12,18,153,65,34,51,72,132,22,177,68,44,17,
+  75,196,18,177,68,44,17,75,196,18,89,0,183,9,68,131,
+  62,113,38,79,3,184,10,69,163,62,15,69,137,25,0,185,
+  11,69,163,62,88,146,8,117,207,2,186,18,71,227,62,221,
+  70,33,201,68,50,17,133,102,58,208,179,2,187,18,72,3,
+  63,215,10,81,36,21,9,69,50,145,140,66,79,12,188,30,
+  76,131,63,39,162,138,76,46,147,139,4,35,193,68,68,23,
+  145,69,18,41,201,32,148,10,169,242,172,0,189,30,77,163,
+  63,119,170,80,34,148,203,4,51,193,72,50,146,216,69,170,
+  68,170,144,42,164,18,13,242,12,1,190,32,76,131,63,23,
+  131,76,46,162,210,228,20,162,76,34,182,136,232,34,178,72,
+  34,150,24,136,82,33,85,158,21,0,191,18,72,3,63,135,
+  121,64,46,166,50,203,133,34,11,205,32,10,192,29,75,99,
+  143,52,155,39,17,14,19,57,133,76,146,210,136,52,162,193,
+  64,162,146,228,18,58,61,57,0,193,28,75,99,155,178,158,
+  68,56,76,228,20,50,73,74,35,210,136,6,3,137,74,146,
+  75,232,244,228,0,194,29,75,99,87,114,24,201,19,8,135,
+  137,156,66,38,73,105,68,26,209,96,32,81,73,114,9,157,
+  158,28,195,30,75,99,63,64,17,75,232,41,132,195,68,78,
+  33,147,164,52,34,141,104,48,144,168,36,185,132,78,79,14,
+  196,29,75,99,63,54,146,39,16,14,19,50,133,76,18,203,
+  136,68,161,193,64,162,146,228,6,57,61,57,0,197,29,75,
+  99,211,48,17,220,83,36,149,137,96,34,151,137,101,82,26,
+  209,96,144,81,73,114,9,157,158,28,198,30,78,195,63,47,
+  6,131,88,34,170,136,42,146,146,164,100,176,209,4,7,59,
+  81,46,21,83,13,246,140,1,199,23,74,67,63,195,129,72,
+  20,81,69,146,93,170,50,33,209,64,167,84,198,54,0,200,
+  19,73,35,75,178,30,56,216,4,27,14,54,193,134,131,61,
+  33,0,201,19,73,35,87,46,152,7,14,54,193,134,131,77,
+  176,225,96,79,8,202,20,73,35,143,78,22,201,227,6,155,
+  96,195,193,38,216,112,176,39,4,203,18,72,3,107,36,15,
+  30,76,114,237,6,147,92,187,193,158,6,204,12,68,131,130,
+  38,148,205,244,223,67,0,205,12,68,131,138,66,146,205,244,
+  223,99,0,206,12,67,99,70,98,144,200,69,250,175,1,207,
+  11,68,131,98,36,153,233,191,199,0,208,28,75,99,63,227,
+  129,44,36,74,133,82,154,88,98,32,202,196,50,41,77,42,
+  20,18,13,244,108,0,209,34,74,67,183,34,150,208,35,85,
+  145,81,100,20,73,104,34,9,77,36,34,169,137,212,40,34,
+  161,68,36,52,73,233,105,1,210,29,75,99,143,52,155,39,
+  24,168,52,86,146,152,36,23,201,69,114,145,152,68,21,210,
+  168,6,122,38,0,211,29,75,99,91,82,153,39,24,168,52,
+  86,146,152,36,23,201,69,114,145,152,68,21,210,168,6,122,
+  38,0,212,30,75,99,87,114,152,200,195,7,42,141,149,36,
+  38,201,69,114,145,92,36,38,81,133,52,170,129,158,9,0,
+  213,30,75,99,63,64,152,208,195,7,42,141,149,36,23,201,
+  69,114,145,92,36,38,81,133,22,171,129,158,9,0,214,29,
+  75,99,63,32,146,167,28,168,52,86,146,152,36,23,201,69,
+  114,145,152,68,21,210,168,6,122,38,0,215,19,79,227,63,
+  127,148,74,102,178,137,116,69,54,147,76,229,121,4,216,32,
+  75,99,63,195,208,96,164,49,154,132,20,145,140,164,166,36,
+  162,137,36,52,146,81,72,163,25,12,66,121,98,0,217,29,
+  74,67,79,52,169,135,198,34,177,72,44,18,139,196,34,177,
+  72,44,18,139,136,36,19,213,32,79,13,218,29,74,67,151,
+  176,30,27,139,196,34,177,72,44,18,139,196,34,177,72,44,
+  34,146,76,84,131,60,53,0,219,30,74,67,147,80,23,201,
+  35,99,145,88,36,22,137,69,98,145,88,36,22,137,69,68,
+  146,137,106,144,167,6,220,29,74,67,119,36,79,20,139,196,
+  34,177,72,44,18,139,196,34,177,72,44,146,146,136,82,131,
+  60,53,0,221,20,74,67,155,176,30,170,146,164,50,70,17,
+  149,34,55,76,118,79,14,222,22,73,35,63,139,96,112,176,
+  9,73,82,145,84,36,36,25,108,130,245,212,0,223,27,72,
+  3,63,241,32,35,145,132,34,25,73,81,36,20,153,132,20,
+  169,68,66,146,136,236,105,0,224,23,72,3,63,85,48,151,
+  30,100,36,186,204,64,162,137,132,34,25,205,34,79,3,225,
+  24,72,3,63,90,22,147,197,7,25,137,46,51,144,104,34,
+  161,72,70,179,200,211,0,226,24,72,3,63,149,69,40,18,
+  30,100,36,186,204,64,162,137,132,34,25,205,34,79,3,227,
+  23,72,3,63,241,32,143,26,100,36,186,204,64,162,137,132,
+  34,25,205,34,79,3,228,23,72,3,63,113,36,143,26,100,
+  36,186,204,64,162,137,132,34,25,205,34,79,3,229,26,72,
+  3,63,88,21,9,69,82,234,65,70,147,203,12,36,154,72,
+  40,146,209,44,242,52,0,230,28,77,163,63,63,24,40,6,
+  153,138,76,46,36,25,28,40,52,185,140,72,33,73,68,52,
+  247,44,1,231,21,72,3,63,103,131,140,68,18,138,228,138,
+  34,54,131,148,78,151,210,0,232,23,72,3,63,54,152,11,
+  166,7,25,77,36,20,25,76,114,161,136,205,32,79,4,233,
+  23,72,3,63,60,150,139,197,7,25,77,36,20,25,76,114,
+  161,136,205,32,79,4,234,24,72,3,63,149,69,40,18,30,
+  100,52,145,80,100,48,201,133,34,54,131,60,17,0,235,23,
+  72,3,63,113,36,143,26,100,36,146,80,100,48,201,133,34,
+  54,131,60,17,0,236,11,67,99,114,38,146,138,244,107,0,
+  237,10,67,99,122,162,44,210,175,1,238,14,70,195,62,116,
+  147,136,100,146,169,126,15,6,239,12,68,131,62,42,146,204,
+  244,123,12,0,240,25,73,35,63,19,69,106,149,73,13,52,
+  38,33,73,42,146,138,132,36,154,208,32,79,9,241,24,72,
+  3,63,241,32,15,74,108,36,146,80,36,20,9,69,66,145,
+  80,36,148,167,1,242,25,73,35,63,92,152,12,230,1,131,
+  144,166,72,146,138,164,34,33,137,38,52,200,83,2,243,24,
+  73,35,63,137,76,87,143,24,132,52,69,146,84,36,21,9,
+  73,52,161,65,158,18,244,25,73,35,63,229,44,145,202,164,
+  7,33,77,145,36,21,73,69,66,18,77,104,144,167,4,245,
+  24,73,35,63,147,65,30,56,8,105,138,36,169,72,42,18,
+  146,104,66,131,60,37,0,246,23,73,35,63,147,122,224,32,
+  164,41,146,164,34,169,72,72,162,9,13,242,148,0,247,16,
+  79,227,63,127,23,207,67,7,247,208,120,158,119,0,248,22,
+  73,35,63,167,153,129,70,83,51,233,66,82,17,177,201,12,
+  52,122,34,0,249,24,72,3,63,54,152,11,134,67,145,80,
+  36,20,9,69,66,145,80,196,102,145,167,1,250,24,72,3,
+  63,90,22,147,165,67,145,80,36,20,9,69,66,145,80,196,
+  102,145,167,1,251,25,72,3,63,149,42,145,138,100,67,145,
+  80,36,20,9,69,66,145,80,196,102,145,167,1,252,23,72,
+  3,63,113,36,15,42,9,69,66,145,80,36,20,9,69,108,
+  22,121,26,0,253,23,72,3,63,93,172,88,164,8,69,108,
+  34,26,69,104,144,146,25,37,82,99,0,254,26,73,35,63,
+  139,96,139,65,198,36,36,73,69,82,145,144,68,35,73,12,
+  50,193,122,4,0,255,23,72,3,63,113,36,143,17,41,66,
+  17,155,72,40,18,26,164,100,102,49,49,0,0,0
+};
+/*
+  Fontname: fur17_hf
+  Glyphs: 189
+  BBX Build Mode: 1
+*/
+const ucg_fntpgm_uint8_t ucg_font_fur17_hf[5924] UCG_FONT_SECTION("ucg_font_fur17_hf") = {
+  189,1,4,2,5,5,1,4,6,23,30,255,250,17,251,17,
+  253,3,169,7,169,32,8,199,151,243,249,255,0,33,14,200,
+  23,244,153,203,252,191,199,201,244,204,0,34,18,202,23,245,
+  57,150,108,36,27,223,132,52,33,77,158,255,24,35,41,209,
+  151,248,249,187,140,84,35,213,72,37,82,141,110,240,32,167,
+  201,102,164,26,169,38,55,120,144,211,72,53,217,140,84,35,
+  213,72,53,121,126,5,36,51,205,151,246,185,13,39,7,179,
+  193,64,164,137,104,52,17,141,38,167,201,13,18,193,193,32,
+  55,24,8,19,131,92,100,151,145,104,50,18,77,70,50,201,
+  104,6,87,131,65,50,156,103,13,37,54,213,151,250,249,15,
+  6,193,220,96,150,219,136,116,34,81,80,164,17,138,52,73,
+  145,68,42,49,30,72,50,131,176,100,176,141,136,148,18,145,
+  50,35,18,134,236,68,118,177,193,78,55,200,243,151,0,38,
+  49,209,151,248,249,163,65,118,48,136,138,148,34,165,102,185,
+  216,14,196,43,213,66,164,146,108,68,155,137,72,181,16,201,
+  6,169,217,76,54,72,13,18,131,129,108,176,217,243,53,0,
+  39,12,200,23,244,153,203,124,151,231,111,1,40,19,200,23,
+  244,57,144,169,100,86,43,153,63,155,185,147,233,177,0,41,
+  18,200,23,244,89,235,114,50,59,153,255,74,102,22,211,163,
+  1,42,26,207,151,247,249,85,38,170,208,38,180,203,193,89,
+  100,146,76,100,21,210,76,158,255,175,0,43,36,216,23,252,
+  249,255,219,60,48,15,204,3,243,192,60,48,15,25,60,208,
+  35,242,192,60,48,15,204,3,243,192,60,48,207,127,6,44,
+  14,198,23,243,249,195,205,70,164,17,233,97,0,45,11,200,
+  23,244,249,167,131,61,207,1,46,11,198,23,243,249,67,145,
+  61,33,0,47,21,201,151,244,185,212,233,114,118,193,156,93,
+  206,46,152,179,203,233,153,1,48,39,205,151,246,249,106,16,
+  28,12,82,34,149,141,76,35,211,200,52,50,141,76,35,211,
+  200,52,50,141,76,36,26,153,13,6,185,65,158,135,0,49,
+  17,205,151,246,249,108,57,8,14,132,10,173,255,239,121,8,
+  50,27,205,151,246,249,106,144,27,12,84,34,209,74,179,210,
+  74,151,211,229,79,165,7,7,121,94,1,51,31,205,151,246,
+  249,106,32,27,12,84,54,43,173,229,112,59,200,110,109,100,
+  154,149,72,116,48,208,13,242,60,4,52,33,205,151,246,249,
+  112,186,28,4,21,66,133,78,34,155,200,52,42,145,74,100,
+  37,26,28,72,6,7,74,173,123,158,1,53,31,205,151,246,
+  249,102,48,80,105,189,24,196,6,3,149,72,21,211,122,35,
+  211,140,84,131,65,112,144,231,33,0,54,39,205,151,246,249,
+  106,160,91,172,108,86,26,173,201,32,165,24,12,50,131,204,
+  213,68,39,209,73,116,18,157,70,165,90,12,98,3,61,239,
+  0,55,25,205,151,246,249,100,112,144,53,213,74,167,90,233,
+  84,43,157,106,165,83,233,158,167,0,56,38,205,151,246,249,
+  106,160,91,172,140,84,34,149,72,101,163,27,232,22,43,27,
+  157,68,39,209,73,116,26,213,102,144,24,196,6,122,222,1,
+  57,36,205,151,246,249,106,32,27,28,169,52,178,137,78,162,
+  147,200,38,171,205,65,104,176,208,154,110,84,34,209,193,64,
+  55,208,243,14,58,13,198,23,243,57,23,217,147,138,236,9,
+  1,59,15,198,23,243,57,23,217,147,138,108,68,246,48,0,
+  60,36,216,23,252,249,255,111,245,168,65,30,50,200,99,246,
+  152,61,104,15,219,3,7,121,224,30,56,200,3,7,121,156,
+  158,255,33,0,61,20,216,23,252,249,255,255,171,193,3,61,
+  239,6,15,244,252,255,21,0,62,36,216,23,252,249,255,231,
+  122,220,32,15,28,228,129,123,228,30,184,135,237,49,131,60,
+  102,143,25,228,33,131,60,74,207,255,21,0,63,25,203,151,
+  245,121,53,72,13,6,26,209,36,166,52,20,238,14,149,246,
+  20,74,61,183,0,64,73,215,151,251,249,31,13,6,241,193,
+  129,116,16,27,4,167,59,241,74,52,72,104,84,154,193,64,
+  115,163,25,105,172,68,26,43,145,198,74,164,177,18,105,172,
+  68,26,43,145,102,163,217,168,52,154,193,64,37,26,68,6,
+  58,61,108,15,219,227,6,138,61,98,48,200,83,0,65,38,
+  209,151,248,249,179,249,122,32,86,104,23,83,141,84,51,84,
+  9,85,186,213,108,112,32,27,60,82,138,148,154,169,68,43,
+  209,238,249,24,66,42,208,23,248,249,229,224,78,52,80,233,
+  70,66,145,80,36,20,233,70,178,213,224,78,53,72,233,70,
+  66,145,80,36,20,233,70,162,129,106,112,207,183,0,67,30,
+  207,151,247,249,213,96,55,56,72,201,54,66,141,80,162,246,
+  115,181,80,36,83,13,14,114,131,61,31,1,68,42,209,151,
+  248,249,139,193,64,169,25,232,204,132,42,161,74,41,82,138,
+  148,34,165,72,41,82,138,148,34,161,74,168,146,205,52,3,
+  221,96,160,231,71,0,69,22,206,23,247,249,116,112,160,17,
+  251,241,224,32,36,246,227,193,129,158,167,0,70,18,205,151,
+  246,249,102,112,144,209,250,237,224,72,235,239,121,12,71,41,
+  209,151,248,249,171,193,114,112,16,211,141,148,34,185,30,160,
+  7,232,1,178,193,70,170,145,106,150,34,165,104,168,218,201,
+  6,7,194,193,64,207,15,72,39,208,23,248,249,165,80,36,
+  20,9,69,66,145,80,36,20,9,69,66,209,224,145,80,36,
+  20,9,69,66,145,80,36,20,9,69,66,61,31,2,73,12,
+  198,23,243,201,69,254,255,61,33,0,74,20,205,151,246,249,
+  84,235,255,141,76,51,82,13,6,178,129,158,135,0,75,39,
+  207,151,247,249,137,78,36,83,153,137,116,154,157,100,168,88,
+  14,164,138,165,98,16,148,12,53,59,209,76,181,146,141,100,
+  35,221,158,47,0,76,17,204,23,246,121,43,245,255,211,193,
+  65,100,112,144,231,24,77,59,213,151,250,249,231,131,228,32,
+  52,72,14,66,131,228,32,164,208,41,68,10,157,66,164,88,
+  45,68,18,149,68,36,81,73,68,146,205,68,164,113,164,113,
+  100,33,114,33,114,33,178,90,137,84,43,145,106,165,231,15,
+  1,78,50,209,151,248,249,139,161,104,144,19,13,100,162,129,
+  76,164,88,137,20,43,145,100,100,35,178,217,136,108,68,162,
+  137,72,181,16,169,22,34,217,64,36,27,136,116,131,144,112,
+  207,231,0,79,42,209,151,248,249,171,129,116,144,24,228,172,
+  148,34,165,70,43,209,74,180,18,173,68,43,209,74,150,27,
+  165,72,169,210,233,6,137,65,116,160,231,55,0,80,29,206,
+  23,247,249,116,48,144,105,6,34,217,70,167,209,105,116,26,
+  217,70,53,26,92,137,253,61,31,1,81,44,210,23,249,249,
+  227,129,118,144,24,4,117,50,165,74,41,210,106,180,26,173,
+  70,171,209,106,180,154,229,72,169,82,202,116,194,65,98,32,
+  29,28,232,249,17,0,82,41,207,151,247,249,201,96,160,211,
+  12,84,178,145,78,164,19,233,68,58,145,234,96,160,83,173,
+  100,42,153,74,54,210,137,116,34,157,72,167,231,19,0,83,
+  38,207,151,247,249,209,96,56,184,146,109,132,26,245,120,16,
+  30,12,132,131,211,193,120,173,17,106,132,34,217,104,144,24,
+  232,6,123,190,2,84,15,207,151,247,249,197,224,65,80,237,
+  255,239,249,12,85,42,209,151,248,249,11,165,72,41,82,138,
+  148,34,165,72,41,82,138,148,34,165,72,41,82,138,148,34,
+  165,74,183,210,233,6,137,65,114,48,200,243,19,0,86,36,
+  207,151,247,249,133,114,161,148,236,54,58,145,78,180,90,153,
+  169,100,155,157,70,168,17,46,150,10,169,66,58,208,142,247,
+  124,6,87,62,214,23,251,249,143,118,179,133,108,16,91,200,
+  6,49,201,106,16,211,168,20,162,141,72,34,114,34,82,105,
+  36,27,149,198,100,37,17,73,100,11,145,68,167,80,41,116,
+  10,213,32,56,136,13,146,179,65,114,183,20,234,249,39,0,
+  88,38,208,23,248,249,229,78,52,91,173,116,27,225,100,185,
+  208,14,194,131,240,32,60,144,42,150,147,161,104,166,58,27,
+  9,39,195,61,223,1,89,28,207,151,247,249,193,112,178,211,
+  204,70,43,153,104,182,17,74,148,11,233,32,60,86,251,61,
+  223,1,90,24,206,23,247,249,116,112,32,214,78,111,167,183,
+  211,7,209,7,209,237,224,61,79,1,91,15,201,151,244,185,
+  26,164,116,254,255,239,6,97,0,92,23,201,151,244,57,210,
+  9,131,58,97,80,39,44,212,9,131,58,97,161,158,5,0,
+  93,14,202,23,245,185,30,4,253,255,63,27,164,1,94,40,
+  215,151,251,249,255,139,60,108,143,74,228,65,10,61,166,30,
+  83,15,209,232,17,169,60,34,149,7,168,228,185,180,78,156,
+  12,39,243,252,75,0,95,12,204,23,246,249,255,63,30,188,
+  39,3,96,12,197,151,242,9,68,26,145,158,111,1,97,33,
+  205,151,246,249,79,7,178,65,98,101,164,210,170,6,3,209,
+  32,163,89,105,100,26,213,104,49,80,13,34,122,94,1,98,
+  36,206,23,247,249,84,236,147,65,76,49,24,132,86,162,213,
+  70,167,209,105,116,26,157,102,181,89,137,6,138,149,100,144,
+  231,53,0,99,25,204,23,246,249,215,3,213,96,32,18,77,
+  100,18,169,103,26,209,102,48,144,13,244,60,100,36,206,23,
+  247,249,141,216,179,65,68,52,56,8,137,6,153,213,70,167,
+  209,105,116,26,157,102,53,82,93,12,100,131,136,158,183,0,
+  101,30,205,151,246,249,79,7,178,193,64,101,35,211,200,52,
+  131,131,140,214,76,164,82,13,6,185,129,158,119,0,102,19,
+  201,151,244,185,27,132,6,34,157,213,96,16,210,249,223,179,
+  6,103,42,206,23,247,249,223,13,20,170,193,145,106,179,218,
+  232,52,58,141,78,163,211,172,70,170,209,32,49,144,13,34,
+  98,145,106,164,146,13,6,193,129,30,4,104,33,206,23,247,
+  249,84,236,147,65,108,160,88,141,70,50,145,76,36,19,201,
+  68,50,145,76,36,19,201,68,50,61,111,1,105,13,197,151,
+  242,201,52,122,140,255,247,36,0,106,15,199,151,243,217,169,
+  244,88,149,255,31,141,164,0,107,29,204,23,246,121,43,245,
+  209,70,51,146,172,20,51,133,110,160,83,232,36,50,201,74,
+  51,114,180,231,26,108,12,198,23,243,201,69,254,255,61,33,
+  0,109,39,213,151,250,249,255,115,201,32,51,80,13,46,6,
+  131,208,65,104,35,179,145,217,200,108,100,54,50,27,153,141,
+  204,70,102,35,179,231,239,0,110,31,206,23,247,249,95,41,
+  6,178,193,213,104,36,19,201,68,50,145,76,36,19,201,68,
+  50,145,76,36,211,243,22,111,32,205,151,246,249,79,7,186,
+  193,64,164,210,172,38,58,137,78,162,147,232,36,171,141,74,
+  53,24,200,6,122,222,1,112,37,206,23,247,249,95,73,6,
+  177,129,98,16,90,137,86,27,157,70,167,209,105,116,154,213,
+  102,37,26,40,6,33,201,32,38,246,30,9,113,37,206,23,
+  247,249,223,13,34,162,65,98,32,82,109,86,27,157,70,167,
+  209,105,116,154,213,72,53,26,36,6,178,65,68,236,123,4,
+  0,114,17,201,151,244,249,149,98,16,25,108,102,58,255,158,
+  57,0,115,28,203,151,245,249,7,3,213,96,32,81,73,148,
+  7,187,193,112,162,146,168,52,139,213,64,207,37,0,116,19,
+  201,151,244,121,169,179,26,12,66,58,255,110,145,26,228,153,
+  2,117,31,206,23,247,249,95,201,68,50,145,76,36,19,201,
+  68,50,145,76,36,19,201,68,87,131,179,65,68,207,91,0,
+  118,29,204,23,246,249,167,58,133,76,178,210,136,54,34,149,
+  70,37,145,45,116,10,221,32,56,72,234,121,2,119,45,211,
+  151,249,249,255,205,106,37,81,173,36,34,69,104,178,81,104,
+  68,26,133,70,36,177,17,73,52,10,153,66,163,144,13,66,
+  10,217,32,53,92,13,101,123,126,13,120,29,205,151,246,249,
+  239,86,162,205,74,35,91,8,7,202,131,228,64,39,89,109,
+  84,162,141,108,207,35,0,121,32,204,23,246,249,167,58,133,
+  76,178,210,136,54,27,149,70,37,89,45,116,10,221,32,121,
+  41,85,46,165,122,12,0,122,21,202,23,245,249,139,193,64,
+  168,155,237,236,118,118,59,225,96,160,231,2,123,22,203,151,
+  245,57,30,228,118,74,63,220,29,14,146,82,165,159,42,7,
+  97,0,124,12,200,23,244,201,115,253,255,255,13,0,125,19,
+  203,151,245,57,92,94,250,229,187,67,165,31,234,6,121,4,
+  0,126,15,204,23,246,249,127,59,144,12,38,131,61,127,13,
+  160,8,199,151,243,249,255,0,161,13,200,23,244,249,82,166,
+  39,144,249,191,5,162,39,206,23,247,249,7,233,202,129,110,
+  48,144,105,18,34,141,66,164,9,106,130,18,161,36,41,201,
+  168,6,145,213,96,32,28,8,211,245,204,0,163,23,205,151,
+  246,249,108,160,91,172,140,180,150,131,65,80,235,95,14,14,
+  244,60,2,164,35,205,151,246,249,56,146,204,36,6,138,208,
+  32,177,82,213,133,114,161,92,40,23,82,165,54,170,196,64,
+  145,73,134,243,252,26,165,30,206,23,247,249,82,168,145,137,
+  100,42,209,74,36,26,72,6,42,137,114,160,28,196,6,239,
+  196,126,207,7,166,13,200,23,244,57,200,245,247,148,185,254,
+  22,167,35,202,23,245,185,30,136,6,27,161,229,110,144,27,
+  136,22,147,141,68,36,209,76,22,163,129,110,16,28,58,201,
+  28,236,129,0,168,12,199,151,243,25,105,6,25,61,255,24,
+  169,54,211,151,249,249,87,3,241,32,49,8,238,102,153,193,
+  36,149,153,76,66,145,145,36,147,145,70,50,210,72,70,26,
+  201,72,35,25,149,166,70,51,9,133,6,155,84,54,166,20,
+  170,196,3,61,127,1,170,27,201,151,244,185,26,104,6,131,
+  136,40,152,25,76,54,145,84,36,164,25,36,162,131,123,126,
+  3,171,25,205,151,246,249,63,211,200,36,50,141,106,34,147,
+  232,38,58,141,78,34,204,232,249,6,172,14,206,23,247,249,
+  127,50,120,221,61,255,21,0,174,58,211,151,249,249,87,3,
+  241,32,49,8,238,102,145,193,32,146,202,104,38,161,140,72,
+  146,9,217,68,66,131,85,36,164,17,69,66,162,146,144,77,
+  141,72,18,202,136,36,169,108,108,55,28,36,6,225,129,158,
+  191,0,175,12,199,151,243,217,14,6,121,254,49,0,176,18,
+  199,151,243,153,109,20,146,76,36,19,81,104,246,252,5,0,
+  177,33,216,23,252,249,255,219,60,48,15,204,3,243,144,193,
+  3,61,34,15,204,3,243,192,60,48,207,243,193,3,61,255,
+  28,178,20,201,151,244,57,27,132,6,19,141,78,230,106,54,
+  24,228,249,59,0,179,21,201,151,244,57,27,132,6,19,141,
+  108,37,220,73,36,155,129,158,63,4,180,11,197,151,242,105,
+  76,52,121,62,6,182,53,205,151,246,249,106,48,72,13,34,
+  169,129,36,52,152,132,6,147,208,96,146,26,72,82,3,73,
+  108,16,73,70,146,145,100,36,25,73,70,146,145,100,36,25,
+  73,70,146,145,100,36,25,201,195,1,183,11,198,23,243,121,
+  43,178,231,21,0,184,13,199,151,243,249,31,199,6,49,149,
+  98,48,185,12,199,151,243,217,137,102,253,158,79,1,186,27,
+  202,23,245,185,30,164,6,27,145,68,21,81,69,84,17,145,
+  70,19,26,200,7,3,61,127,1,187,25,205,151,246,249,63,
+  146,8,37,58,141,78,162,155,200,36,50,141,76,34,147,232,
+  249,12,188,44,210,23,249,249,75,157,108,151,140,41,99,209,
+  148,52,149,13,133,51,226,76,72,42,146,134,18,73,77,36,
+  153,145,4,67,131,65,74,152,75,198,148,121,126,6,189,44,
+  211,151,249,249,23,194,220,78,153,139,198,164,41,109,42,28,
+  18,135,210,25,201,64,41,89,12,51,118,66,93,80,39,27,
+  198,148,49,165,108,48,200,243,83,0,190,50,211,151,249,249,
+  7,3,93,106,48,72,73,85,73,89,116,144,17,107,130,26,
+  137,80,50,137,14,36,26,173,72,27,74,68,53,138,104,70,
+  146,212,12,6,185,96,101,78,153,231,199,0,191,24,204,23,
+  246,249,15,164,122,34,169,229,112,183,52,53,147,12,50,7,
+  3,217,64,15,192,45,209,151,248,113,123,128,30,161,71,228,
+  25,205,215,3,177,66,187,152,106,164,154,161,74,168,210,173,
+  102,131,3,217,224,145,82,164,212,76,37,90,137,118,207,199,
+  0,193,44,209,151,248,193,114,61,32,15,200,51,154,175,7,
+  98,133,118,49,213,72,53,67,149,80,165,91,205,6,7,178,
+  193,35,165,72,169,153,74,180,18,237,158,143,1,194,45,209,
+  151,248,145,243,65,88,33,206,232,89,204,215,3,177,66,187,
+  152,106,164,154,161,74,168,210,173,102,131,3,217,224,145,82,
+  164,212,76,37,90,137,118,207,199,0,195,42,209,151,248,73,
+  23,82,197,158,163,249,122,32,86,104,23,83,141,84,51,84,
+  9,85,186,213,108,112,32,27,60,82,138,148,154,169,68,43,
+  209,238,249,24,196,42,210,23,249,137,53,90,141,158,187,249,
+  32,62,16,47,196,18,177,100,42,146,138,134,43,161,236,224,
+  217,224,153,82,36,21,73,39,91,137,88,207,143,0,197,45,
+  209,151,248,214,10,113,38,156,73,239,217,204,215,3,177,66,
+  172,152,106,164,154,225,72,168,18,202,100,131,3,217,224,145,
+  82,164,212,76,37,90,137,118,207,199,0,198,50,215,151,251,
+  249,95,13,30,68,7,121,204,64,143,81,232,33,11,61,196,
+  30,49,209,35,52,122,192,102,112,32,19,201,71,242,193,245,
+  74,45,19,207,196,58,173,112,112,160,231,31,1,199,36,207,
+  151,247,249,213,96,55,56,72,201,54,66,141,80,162,246,115,
+  181,80,51,83,13,14,114,131,109,124,144,94,43,7,123,12,
+  0,200,25,206,23,247,49,106,235,60,217,224,64,35,246,227,
+  193,65,72,236,199,131,3,61,79,1,201,26,206,23,247,113,
+  90,177,86,79,54,56,208,136,253,120,112,16,18,251,241,224,
+  64,207,83,0,202,29,206,23,247,65,131,232,32,41,17,134,
+  242,68,131,3,141,216,143,7,7,33,177,31,15,14,244,60,
+  5,203,25,206,23,247,73,12,37,122,54,131,3,141,216,143,
+  7,7,33,177,31,15,14,244,60,5,204,14,198,23,211,84,
+  86,121,132,200,255,191,39,4,205,15,198,23,83,53,162,144,
+  30,33,242,255,239,9,1,206,17,198,23,19,39,131,72,100,
+  144,137,139,252,255,123,66,0,207,14,199,151,211,53,131,140,
+  30,168,242,255,239,25,208,44,209,151,248,249,139,193,64,169,
+  25,232,100,51,161,74,168,82,138,148,34,165,100,48,80,137,
+  148,34,165,72,41,18,170,116,43,217,76,51,208,13,6,122,
+  126,4,209,54,209,151,248,73,23,210,193,158,249,80,52,200,
+  137,6,50,209,64,38,82,172,68,138,149,72,50,178,17,217,
+  108,68,54,34,209,68,164,90,136,84,11,145,108,32,146,13,
+  68,186,65,72,184,231,115,0,210,49,209,151,184,246,0,61,
+  66,143,200,35,244,76,6,210,65,98,144,179,82,138,148,26,
+  173,68,43,209,74,180,18,173,68,43,89,110,148,34,165,74,
+  167,27,36,6,209,129,158,223,0,211,47,209,151,56,231,246,
+  128,60,64,207,102,32,29,36,6,57,43,165,72,169,209,74,
+  180,18,173,68,43,209,74,180,146,229,70,41,82,170,116,186,
+  65,98,16,29,232,249,13,0,212,48,209,151,248,230,107,133,
+  56,147,21,229,25,12,164,131,196,32,103,165,20,41,53,90,
+  137,86,162,149,104,37,90,137,86,178,220,40,69,74,149,78,
+  55,72,12,162,3,61,191,1,213,43,209,151,248,73,23,82,
+  197,158,155,129,116,144,24,228,172,148,34,165,70,43,209,74,
+  180,18,173,68,43,209,74,150,27,165,104,183,186,27,156,14,
+  244,252,6,214,46,209,151,248,73,37,90,137,158,147,129,116,
+  144,24,228,172,148,34,165,70,43,209,74,180,18,173,68,43,
+  209,74,150,27,165,72,169,210,233,6,137,65,116,160,231,55,
+  0,215,36,215,151,251,249,255,55,74,173,78,173,210,3,52,
+  122,136,66,15,218,163,246,32,133,30,162,209,3,84,106,157,
+  86,169,231,127,1,216,60,209,151,248,249,50,15,216,13,22,
+  178,65,98,32,147,13,66,186,65,72,166,152,200,38,102,26,
+  137,106,35,17,141,36,34,149,68,179,146,44,86,27,133,76,
+  52,144,137,6,49,217,64,49,136,41,6,187,61,32,207,59,
+  0,217,46,209,151,184,246,0,61,66,143,200,67,242,212,74,
+  145,82,164,20,41,69,74,145,82,164,20,41,69,74,145,82,
+  164,20,41,69,67,149,110,117,55,184,28,12,242,252,4,218,
+  44,209,151,56,231,246,128,60,64,79,174,20,41,69,74,145,
+  82,164,20,41,69,74,145,82,164,20,41,69,74,145,82,52,
+  84,233,86,119,131,203,193,32,207,79,0,219,46,209,151,248,
+  230,107,133,56,147,21,229,105,149,34,165,72,41,82,138,148,
+  34,165,72,41,82,138,148,34,165,72,41,82,138,134,42,221,
+  234,110,112,57,24,228,249,9,0,220,46,209,151,248,73,37,
+  90,137,158,181,82,164,20,41,69,74,145,82,164,20,41,69,
+  74,145,82,164,20,41,69,74,145,82,165,91,233,116,131,196,
+  32,57,24,228,249,9,0,221,32,207,151,247,129,98,181,88,
+  79,55,156,236,52,179,209,74,38,154,109,132,18,229,66,58,
+  8,143,213,126,207,119,0,222,27,206,23,247,249,84,236,120,
+  112,165,26,201,54,58,141,78,163,211,168,70,131,43,177,247,
+  124,4,223,44,205,151,246,249,106,32,27,12,68,43,141,76,
+  163,218,136,70,154,149,70,166,145,137,70,170,65,68,183,16,
+  42,132,10,137,72,33,25,36,36,162,65,158,87,0,224,37,
+  205,151,246,121,39,22,135,245,84,3,217,32,177,50,82,105,
+  85,131,129,104,144,209,172,52,50,141,106,180,24,168,6,17,
+  61,175,0,225,38,205,151,246,57,150,106,165,218,60,221,64,
+  54,72,172,140,84,90,213,96,32,26,100,52,43,141,76,163,
+  26,45,6,170,65,68,207,43,0,226,40,205,151,246,57,189,
+  84,232,36,186,144,158,102,32,27,36,86,70,42,173,106,48,
+  16,13,50,154,149,70,166,81,141,22,3,213,32,162,231,21,
+  0,227,36,205,151,246,249,106,33,27,236,153,12,100,131,196,
+  202,86,56,80,13,6,162,145,70,166,81,109,84,163,197,64,
+  53,136,232,121,5,228,37,205,151,246,249,72,35,211,232,89,
+  12,100,131,196,202,72,165,85,13,6,162,65,70,179,210,200,
+  52,170,209,98,160,26,68,244,188,2,229,42,205,151,246,25,
+  47,21,194,76,48,19,84,40,247,84,3,217,32,177,50,82,
+  105,85,131,129,104,144,209,172,52,50,141,106,180,24,168,6,
+  10,61,175,0,230,48,212,23,250,249,255,163,65,104,160,26,
+  12,20,131,65,72,52,8,105,87,82,153,104,240,65,102,144,
+  145,174,164,178,149,68,53,8,137,6,131,200,96,144,26,136,
+  6,122,254,6,231,31,204,23,246,249,215,3,213,96,32,18,
+  77,100,18,169,103,26,209,102,48,144,13,132,217,65,116,42,
+  27,232,1,232,34,205,151,246,57,20,139,195,246,84,3,217,
+  96,160,178,145,105,100,154,193,65,70,107,38,82,169,6,131,
+  220,64,207,59,0,233,34,205,151,246,57,150,78,109,243,116,
+  3,217,96,160,178,145,105,100,154,193,65,70,107,38,82,169,
+  6,131,220,64,207,59,0,234,38,205,151,246,57,149,14,146,
+  138,160,68,23,202,19,13,100,131,129,202,70,166,145,105,6,
+  7,25,173,153,72,165,26,12,114,3,61,239,0,235,35,205,
+  151,246,249,72,35,211,232,89,12,116,139,65,72,165,153,73,
+  116,146,193,129,68,107,167,81,169,22,131,216,64,207,59,0,
+  236,15,198,23,243,201,84,86,121,132,200,255,61,33,0,237,
+  15,198,23,243,73,53,70,121,136,200,255,61,33,0,238,17,
+  198,23,243,233,6,145,65,66,50,138,139,252,223,19,2,239,
+  15,199,151,243,25,73,20,18,61,82,229,255,158,1,240,40,
+  205,151,246,249,70,36,27,12,7,185,197,118,55,24,132,6,
+  71,170,201,76,162,147,232,36,58,137,78,50,211,168,84,131,
+  129,108,160,231,29,0,241,35,206,23,247,249,90,18,28,236,
+  217,40,6,178,193,213,104,36,19,201,68,50,145,76,36,19,
+  201,68,50,145,76,36,211,243,22,242,37,205,151,246,57,220,
+  138,197,233,60,213,64,55,24,136,84,154,213,68,39,209,73,
+  116,18,157,100,181,81,169,6,3,217,64,207,59,0,243,36,
+  205,151,246,57,158,218,102,245,100,3,221,96,32,82,105,86,
+  19,157,68,39,209,73,116,146,213,70,165,26,12,100,3,61,
+  239,0,244,39,205,151,246,57,189,84,8,51,57,141,158,102,
+  160,27,12,68,42,205,106,162,147,232,36,58,137,78,178,218,
+  168,84,131,129,108,160,231,29,0,245,36,205,151,246,249,106,
+  33,27,236,153,12,116,131,129,72,165,89,77,116,18,157,68,
+  39,209,73,86,27,149,106,48,144,13,244,188,3,246,36,205,
+  151,246,249,72,35,211,232,89,12,116,131,129,72,165,89,77,
+  116,18,157,68,39,209,73,86,27,149,106,48,144,13,244,188,
+  3,247,25,216,23,252,249,255,159,235,113,122,156,158,163,193,
+  3,61,169,30,167,199,233,249,127,8,248,39,205,151,246,249,
+  143,178,170,193,32,53,24,136,68,155,3,137,40,98,35,113,
+  35,81,136,36,3,205,145,104,144,24,132,18,3,149,158,19,
+  0,249,35,206,23,247,57,87,139,213,234,60,153,145,76,36,
+  19,201,68,50,145,76,36,19,201,68,50,209,213,98,32,27,
+  68,244,188,5,250,36,206,23,247,121,163,21,107,197,121,58,
+  153,72,38,146,137,100,34,153,72,38,146,137,100,34,153,232,
+  106,49,144,13,34,122,222,2,251,40,206,23,247,121,161,29,
+  68,7,73,137,48,148,39,146,137,100,34,153,72,38,146,137,
+  100,34,153,72,38,146,137,174,22,3,217,32,162,231,45,0,
+  252,35,206,23,247,249,88,34,148,232,217,200,68,50,145,76,
+  36,19,201,68,50,145,76,36,19,201,68,87,131,179,65,68,
+  207,91,0,253,37,204,23,246,121,36,85,218,19,232,20,50,
+  201,74,35,218,108,84,26,149,100,181,208,41,116,131,228,165,
+  84,166,152,13,132,123,16,0,254,38,206,23,247,249,84,236,
+  147,65,108,160,24,132,86,162,213,70,167,209,105,116,26,157,
+  102,181,89,137,6,138,65,72,50,136,137,189,71,2,255,36,
+  205,151,246,249,72,35,211,232,169,117,146,153,70,181,81,137,
+  54,43,141,108,162,83,236,20,194,129,114,122,170,149,78,245,
+  40,0,0,0
+};
+/*
+  Fontname: fur35_hf
+  Glyphs: 189
+  BBX Build Mode: 1
+*/
+const ucg_fntpgm_uint8_t ucg_font_fur35_hf[13218] UCG_FONT_SECTION("ucg_font_fur35_hf") = {
+  189,1,5,4,6,7,1,5,7,48,64,254,243,35,247,36,
+  250,8,2,17,51,32,12,14,240,112,126,248,255,255,63,14,
+  0,33,21,18,240,144,126,248,247,74,171,255,255,255,62,84,
+  74,171,251,240,195,0,34,49,22,240,176,126,248,159,43,165,
+  156,82,10,34,165,32,98,8,34,134,32,98,8,34,134,32,
+  98,8,34,134,32,98,8,34,134,32,98,70,26,103,164,113,
+  198,135,255,255,191,4,0,35,101,36,240,32,127,248,255,223,
+  32,134,216,113,198,29,134,88,98,136,37,102,220,97,136,37,
+  134,88,98,198,29,103,88,98,200,123,128,165,7,88,122,128,
+  61,98,198,29,103,220,97,136,37,134,216,113,198,29,134,88,
+  98,200,123,128,165,7,88,122,128,61,98,198,29,103,220,97,
+  136,37,134,88,98,198,29,134,88,98,136,37,102,220,113,134,
+  37,134,88,98,136,29,103,124,248,255,81,0,36,108,27,240,
+  216,126,248,111,139,44,171,9,186,245,128,72,15,140,84,136,
+  24,229,148,34,8,57,196,8,82,12,49,130,148,82,140,32,
+  165,20,35,30,49,226,17,35,94,41,226,157,33,224,130,238,
+  189,246,94,139,34,32,40,136,121,162,148,39,74,121,194,144,
+  39,12,33,197,8,83,70,49,194,16,82,140,48,132,20,35,
+  12,41,165,136,82,138,33,130,24,243,64,65,15,12,245,64,
+  96,141,138,44,247,225,183,0,37,137,44,240,96,127,248,255,
+  255,210,144,6,14,184,26,121,141,141,103,72,81,228,21,83,
+  210,120,229,20,52,96,65,4,13,88,16,57,35,22,68,206,
+  136,5,17,51,100,65,164,16,89,16,41,99,150,83,200,168,
+  228,20,50,170,33,133,140,219,202,192,171,12,99,222,49,132,
+  40,61,72,187,100,20,82,238,24,197,148,58,72,57,164,14,
+  66,80,153,163,16,84,230,40,4,21,57,74,65,37,18,67,
+  80,137,227,16,84,32,57,4,21,56,80,57,4,142,84,76,
+  129,67,21,82,224,96,13,142,166,226,128,230,195,255,127,22,
+  0,38,106,37,240,40,127,248,255,15,37,221,238,171,198,144,
+  90,16,161,36,17,74,18,161,36,17,90,14,169,197,20,91,
+  72,185,38,152,188,54,226,40,21,151,82,97,12,149,101,132,
+  57,101,21,98,76,81,197,152,82,84,57,134,148,84,208,25,
+  37,149,100,6,81,69,25,65,84,89,38,16,85,152,82,165,
+  161,85,220,97,197,25,102,24,98,38,173,245,0,91,15,16,
+  97,216,43,166,45,100,62,252,255,97,0,39,19,18,240,144,
+  126,248,247,74,171,28,253,185,241,166,15,255,255,7,40,36,
+  17,240,136,126,248,131,195,141,70,218,104,20,35,141,198,10,
+  35,141,98,245,255,53,90,43,141,206,145,70,220,112,196,77,
+  31,14,41,42,17,240,136,126,248,91,227,13,55,28,105,196,
+  145,70,57,210,104,173,176,210,232,255,99,21,35,141,98,133,
+  145,70,49,210,72,27,110,180,241,225,10,0,42,64,31,240,
+  248,126,248,255,91,162,8,74,10,153,100,16,74,6,169,99,
+  140,59,194,200,34,136,41,74,41,130,61,64,216,3,132,149,
+  49,70,153,37,143,48,46,9,196,142,49,42,25,100,146,66,
+  230,40,195,134,18,62,252,255,255,63,6,0,43,89,49,240,
+  136,127,248,255,255,255,31,28,31,188,241,193,27,31,188,241,
+  193,27,31,188,241,193,27,31,188,241,193,27,31,188,241,193,
+  27,31,188,241,193,27,31,136,7,28,125,192,209,7,220,7,
+  98,124,240,198,7,111,124,240,198,7,111,124,240,198,7,111,
+  124,240,198,7,111,124,240,198,7,111,124,240,198,7,111,124,
+  248,255,127,9,0,44,26,13,240,104,126,248,255,95,48,167,
+  160,114,10,170,16,65,5,145,68,210,72,228,195,10,0,45,
+  16,16,240,128,126,248,255,95,97,132,247,225,127,29,0,46,
+  15,13,240,104,126,248,255,95,40,168,222,135,23,1,47,55,
+  19,240,152,126,248,71,199,35,111,192,241,200,27,112,60,242,
+  6,156,30,121,3,142,71,222,128,211,35,111,192,241,200,27,
+  112,60,234,13,56,30,121,3,142,71,222,128,211,35,111,192,
+  241,200,135,47,2,48,91,27,240,216,126,248,127,74,65,214,
+  30,8,235,129,160,202,49,169,160,74,149,67,86,57,132,17,
+  83,24,49,133,149,82,88,41,133,149,82,88,41,133,149,82,
+  88,41,133,149,82,88,41,133,149,82,88,41,133,149,82,88,
+  41,133,149,82,88,49,132,21,67,24,57,132,145,83,84,65,
+  68,21,84,37,99,140,122,32,48,231,88,76,31,254,239,1,
+  49,32,27,240,216,126,248,255,150,161,103,34,153,224,122,236,
+  153,80,30,25,229,137,82,108,253,255,255,247,225,127,18,0,
+  50,57,27,240,216,126,248,127,75,189,214,222,122,64,40,115,
+  10,50,137,160,162,202,41,170,156,162,202,41,170,216,202,18,
+  91,106,169,166,86,213,80,251,209,67,237,234,3,198,60,96,
+  204,3,198,60,96,62,252,95,2,51,73,27,240,216,126,248,
+  127,74,61,199,30,8,235,1,145,204,49,168,164,114,202,34,
+  167,44,114,202,42,150,92,98,75,45,243,64,21,209,76,82,
+  213,115,43,91,110,177,85,41,172,148,194,74,49,171,20,179,
+  200,41,170,156,99,14,122,96,168,7,2,115,79,125,248,191,
+  7,0,52,72,27,240,216,126,248,255,154,161,215,68,50,69,
+  21,73,40,144,136,242,138,40,143,140,226,8,41,173,144,210,
+  72,41,140,152,178,138,41,139,156,162,8,42,169,160,146,72,
+  42,136,168,114,138,42,135,172,114,30,72,227,129,52,30,72,
+  227,129,36,139,173,191,15,255,131,0,53,65,27,240,216,126,
+  248,255,196,3,35,61,48,210,3,35,61,48,82,177,245,39,
+  78,43,65,173,7,132,66,165,36,131,42,69,16,89,229,16,
+  70,46,125,166,48,98,202,42,166,44,114,138,42,200,156,162,
+  30,16,234,129,208,218,83,31,254,55,1,54,82,27,240,216,
+  126,248,127,75,189,214,222,58,165,168,130,170,84,80,81,228,
+  148,69,78,177,228,210,145,195,200,80,169,136,118,74,112,39,
+  149,99,78,42,198,172,82,204,42,165,52,82,74,35,165,52,
+  82,74,43,164,52,82,74,35,134,52,98,202,42,166,44,130,
+  204,49,233,1,177,94,107,48,125,248,191,7,0,55,54,27,
+  240,216,126,248,255,194,3,198,60,96,204,3,198,60,96,46,
+  177,197,18,91,89,98,171,90,108,177,196,86,150,216,170,22,
+  91,213,98,75,45,182,170,197,150,106,106,177,165,22,91,62,
+  252,15,3,56,88,27,240,216,126,248,127,106,185,183,30,16,
+  233,1,130,204,177,146,49,101,21,83,86,49,101,21,83,86,
+  49,101,149,67,22,65,37,149,100,138,89,207,173,199,220,91,
+  197,152,84,157,178,200,33,172,148,210,72,41,141,148,210,72,
+  41,141,148,210,72,41,141,148,194,138,41,171,24,131,12,122,
+  128,164,7,196,122,110,125,248,63,7,0,57,84,27,240,216,
+  126,248,127,106,57,199,30,8,234,129,129,172,83,84,57,100,
+  21,83,88,41,133,149,82,88,41,133,149,82,88,41,133,149,
+  82,88,41,101,25,67,150,49,37,29,115,12,58,15,20,212,
+  66,73,75,148,117,72,177,149,37,151,216,114,200,42,135,168,
+  130,74,170,78,81,15,136,245,90,123,234,195,255,65,0,58,
+  19,13,240,104,126,248,223,43,168,222,135,151,10,170,247,225,
+  69,0,59,28,13,240,104,126,248,223,43,168,222,135,151,204,
+  41,168,58,5,21,68,18,65,36,81,105,124,88,1,60,78,
+  49,240,136,127,248,255,255,255,255,17,241,65,43,31,172,243,
+  1,66,31,28,244,1,58,31,32,244,1,58,31,160,243,65,
+  58,31,160,243,129,42,31,180,241,193,51,31,184,243,65,59,
+  31,184,243,65,67,31,180,243,65,67,31,52,244,65,59,31,
+  180,243,129,35,31,64,241,225,255,255,47,0,61,37,49,240,
+  136,127,248,255,255,255,255,255,221,7,28,125,192,209,7,220,
+  135,255,200,3,142,62,224,232,3,238,195,255,255,255,255,6,
+  0,62,78,49,240,136,127,248,255,255,255,255,144,248,0,150,
+  15,218,249,160,161,15,26,250,160,157,15,26,250,160,157,15,
+  220,249,160,157,15,220,249,192,149,15,222,248,128,153,15,210,
+  249,32,157,15,208,249,0,161,15,208,249,0,161,15,14,250,
+  0,157,15,210,249,96,145,15,156,248,240,255,255,199,1,63,
+  45,25,240,200,126,248,191,164,92,91,15,4,244,128,56,40,
+  168,98,146,41,131,21,35,88,161,53,74,104,153,181,73,102,
+  141,146,74,223,135,141,66,235,62,252,175,2,64,171,48,240,
+  128,127,248,255,255,199,212,7,228,1,209,31,48,249,1,85,
+  147,74,243,192,19,13,53,207,220,226,74,46,172,236,162,10,
+  47,170,36,51,138,33,169,32,21,138,41,168,156,7,196,33,
+  136,28,67,208,33,136,156,114,204,41,166,66,230,20,83,165,
+  114,138,41,134,168,114,138,41,134,168,114,138,41,134,168,114,
+  138,41,165,168,114,138,41,165,168,114,138,41,134,168,114,138,
+  41,134,168,114,138,41,134,168,114,8,34,166,164,98,10,34,
+  166,32,99,10,42,166,24,68,74,42,167,144,7,134,34,135,
+  9,182,202,81,99,49,131,140,73,174,216,2,205,7,204,124,
+  192,206,7,235,124,176,212,18,251,1,195,31,40,31,128,7,
+  196,7,131,125,248,75,0,65,93,36,240,32,127,248,255,159,
+  48,222,116,196,209,78,91,105,18,74,46,162,96,50,202,45,
+  164,216,66,74,45,165,212,98,10,37,167,204,130,138,44,168,
+  196,162,10,44,170,64,178,202,43,172,184,194,74,123,32,177,
+  7,210,122,64,173,7,150,34,146,164,34,11,42,178,156,66,
+  139,41,180,24,82,75,41,182,144,98,203,40,184,136,130,203,
+  135,255,31,1,66,100,32,240,0,127,248,255,163,15,12,247,
+  64,97,15,28,245,0,74,101,157,84,154,65,197,21,84,30,
+  65,229,17,84,30,65,229,17,84,30,65,197,21,84,90,73,
+  101,25,245,128,89,15,144,246,64,97,15,28,85,214,73,197,
+  21,84,94,57,229,149,83,32,57,5,146,83,96,49,5,146,
+  83,94,57,229,149,83,218,57,101,33,244,0,74,15,28,245,
+  128,89,15,140,15,255,239,2,67,63,32,240,0,127,248,255,
+  237,53,223,123,128,176,7,202,58,201,168,210,10,42,174,160,
+  242,200,41,144,156,2,201,33,156,236,250,31,167,241,2,9,
+  34,144,160,226,74,42,173,36,163,204,122,160,180,7,198,123,
+  32,72,246,225,255,187,0,68,98,34,240,16,127,248,255,87,
+  223,124,128,188,7,76,123,224,176,162,208,42,236,168,226,76,
+  42,175,164,2,11,42,176,160,18,203,41,177,156,18,203,41,
+  146,156,34,201,41,146,156,34,201,41,178,152,34,201,41,146,
+  156,34,201,41,146,156,18,203,41,177,156,18,9,42,176,160,
+  242,12,42,175,164,226,76,42,236,168,162,208,122,224,176,7,
+  76,123,128,188,247,225,255,187,0,69,50,29,240,232,126,248,
+  255,141,7,206,121,224,156,7,206,121,224,156,130,235,63,252,
+  128,65,15,24,244,128,65,15,24,84,112,253,15,63,112,206,
+  3,231,60,112,206,3,231,195,255,33,0,70,40,27,240,216,
+  126,248,255,196,3,229,60,80,206,3,229,60,80,78,177,245,
+  159,125,128,160,7,8,122,128,160,7,8,42,182,254,127,31,
+  254,199,1,71,100,36,240,32,127,248,255,47,132,222,234,3,
+  66,62,64,222,3,167,29,117,150,113,70,21,88,82,145,36,
+  145,73,80,249,0,144,15,2,249,0,148,15,64,249,0,148,
+  15,64,249,0,20,214,76,97,205,20,214,76,97,205,20,90,
+  76,161,229,16,90,78,153,229,148,89,78,153,5,21,89,80,
+  145,37,149,88,146,129,69,157,102,214,3,138,61,144,220,3,
+  38,190,15,255,191,5,0,72,101,34,240,16,127,248,255,87,
+  11,44,168,192,130,10,44,168,192,130,10,44,168,192,130,10,
+  44,168,192,130,10,44,168,192,130,10,44,168,192,130,10,44,
+  168,192,130,10,44,232,129,133,30,88,232,129,133,30,88,168,
+  192,130,10,44,168,192,130,10,44,168,192,130,10,44,168,192,
+  130,10,44,168,192,130,10,44,168,192,130,10,44,168,192,130,
+  10,44,168,192,130,10,44,31,254,63,6,0,73,17,12,240,
+  96,126,248,84,57,245,255,255,255,223,135,71,0,74,39,27,
+  240,216,126,248,255,98,177,245,255,255,103,201,41,139,156,178,
+  200,41,170,32,146,12,42,199,168,7,194,122,32,52,6,213,
+  135,255,77,0,75,95,32,240,0,127,248,255,163,165,25,84,
+  152,73,101,25,85,148,89,37,25,86,144,105,5,21,87,78,
+  121,197,20,88,74,137,133,152,88,134,145,69,152,89,130,161,
+  171,42,187,42,163,37,156,89,196,145,101,156,88,136,137,165,
+  24,88,202,121,197,28,87,206,105,5,153,86,146,97,69,153,
+  85,212,81,101,157,84,216,65,165,25,84,156,57,229,153,15,
+  255,239,1,76,28,25,240,200,126,248,127,161,208,250,255,255,
+  255,232,3,165,60,80,202,3,165,60,80,62,252,7,1,77,
+  154,43,240,88,127,248,255,255,20,162,7,161,137,16,154,8,
+  165,152,80,138,9,165,152,144,122,10,169,71,66,65,37,144,
+  71,66,65,37,148,86,66,65,69,144,70,68,65,69,144,70,
+  68,65,69,148,85,68,65,101,144,69,70,65,101,148,84,70,
+  65,101,148,84,70,65,133,144,68,72,65,133,148,83,72,65,
+  133,148,67,74,65,165,144,67,74,65,165,212,80,49,164,16,
+  83,80,49,164,16,83,80,49,101,20,83,80,57,100,144,83,
+  80,57,68,148,83,80,57,37,148,83,80,65,36,16,84,161,
+  132,170,116,82,65,37,157,84,80,73,39,21,84,84,133,138,
+  170,80,81,213,135,255,255,10,0,78,121,35,240,24,127,248,
+  255,207,156,87,208,121,5,33,87,80,106,5,165,86,144,98,
+  5,41,86,208,90,5,149,80,86,65,37,24,85,80,17,69,
+  21,84,132,73,5,149,97,80,53,12,170,136,57,5,149,82,
+  78,65,165,24,83,80,49,21,42,198,148,130,202,41,165,160,
+  114,12,41,168,32,51,10,42,200,140,130,74,50,162,160,162,
+  138,40,168,40,19,10,42,171,132,130,202,90,168,48,133,10,
+  83,168,180,132,74,75,168,56,132,202,59,168,188,243,225,255,
+  203,0,79,96,37,240,40,127,248,255,47,53,251,128,152,15,
+  144,248,128,121,102,153,102,45,3,139,42,177,164,50,11,42,
+  179,32,82,9,34,149,156,82,139,41,181,152,82,139,41,181,
+  152,82,139,41,181,152,82,139,41,181,152,82,139,41,181,28,
+  82,9,34,149,160,50,11,42,179,36,34,139,42,177,172,242,
+  74,43,205,180,147,206,123,192,196,7,8,125,120,125,248,255,
+  71,0,80,64,30,240,240,126,248,255,205,247,30,24,236,129,
+  162,30,48,169,36,132,10,43,168,180,114,74,43,167,180,114,
+  74,43,167,180,114,74,43,167,180,114,74,43,167,176,130,74,
+  66,232,1,147,30,40,234,129,193,222,43,185,254,191,15,255,
+  15,1,81,101,38,240,48,127,248,255,47,179,251,128,160,15,
+  16,249,128,129,102,25,103,154,97,6,150,85,98,81,101,150,
+  84,102,73,164,146,68,42,65,165,150,83,106,57,165,150,83,
+  106,57,165,150,83,106,57,165,150,83,106,57,165,150,83,106,
+  65,164,146,68,42,73,101,150,84,102,81,68,150,85,98,97,
+  229,21,87,154,113,39,29,248,128,9,71,61,208,216,3,203,
+  61,144,62,252,255,51,0,82,100,30,240,240,126,248,255,205,
+  7,130,123,128,172,7,76,122,224,160,162,14,42,204,156,210,
+  202,41,142,156,226,200,41,142,156,226,200,41,142,156,210,202,
+  41,172,160,162,76,122,160,168,7,6,123,128,172,7,138,42,
+  202,164,178,74,42,172,160,194,10,42,172,160,210,8,42,141,
+  160,210,202,41,173,156,210,202,41,142,156,226,200,41,142,156,
+  226,138,41,174,152,242,200,135,255,163,0,83,78,32,240,0,
+  127,248,255,229,53,31,8,239,129,209,30,40,171,82,165,149,
+  68,30,73,228,17,84,30,73,132,19,94,182,209,40,171,235,
+  230,3,65,62,16,166,187,74,159,93,120,217,149,41,176,152,
+  2,139,41,176,156,242,8,42,174,160,163,140,122,224,172,7,
+  74,123,64,68,246,225,255,203,0,84,28,30,240,240,126,248,
+  255,193,7,154,120,160,137,7,154,120,160,181,146,235,255,255,
+  255,251,240,255,0,85,100,35,240,24,127,248,255,207,20,89,
+  78,145,229,20,89,78,145,229,20,89,78,145,229,20,89,78,
+  145,229,20,89,78,145,229,20,89,78,145,229,20,89,78,145,
+  229,20,89,78,145,229,20,89,78,145,229,20,89,78,145,229,
+  20,73,80,145,4,21,73,80,145,4,21,73,18,137,37,145,
+  88,82,129,68,149,87,86,105,102,29,101,218,3,230,61,80,
+  224,3,130,182,15,255,191,0,0,86,90,31,240,248,126,248,
+  255,11,101,22,97,100,25,37,154,81,98,33,6,150,82,158,
+  41,229,21,99,92,57,165,153,83,90,65,134,149,84,150,73,
+  101,21,101,84,89,37,153,85,82,105,5,149,86,142,105,229,
+  148,87,76,121,165,20,88,74,137,133,148,88,70,145,101,148,
+  89,68,153,37,20,90,66,169,170,38,155,46,186,39,91,31,
+  254,31,3,87,160,47,240,120,127,248,255,255,75,197,153,87,
+  68,113,167,25,81,220,105,133,20,134,90,33,133,161,86,72,
+  97,105,21,83,22,9,100,21,83,84,9,100,21,83,84,9,
+  100,145,83,20,17,37,21,84,18,25,36,21,84,13,146,10,
+  170,6,73,68,17,68,72,57,69,149,67,10,57,69,21,83,
+  10,57,132,17,67,76,41,133,17,67,14,41,133,149,66,14,
+  41,133,21,82,14,41,196,17,66,80,25,197,149,65,18,25,
+  197,149,65,18,25,4,18,81,18,25,4,18,65,84,9,5,
+  150,64,22,9,36,170,69,2,145,136,145,64,36,106,72,162,
+  118,232,105,135,26,119,168,121,197,150,87,44,129,229,195,255,
+  255,9,0,88,91,34,240,16,127,248,255,71,13,52,199,56,
+  147,76,43,202,48,179,140,50,205,164,226,12,50,207,156,18,
+  139,41,210,144,66,205,40,181,136,98,23,86,25,233,195,205,
+  70,57,101,117,75,48,181,140,82,203,48,179,20,19,141,41,
+  177,28,243,74,50,205,168,210,202,50,171,52,147,140,51,168,
+  60,115,74,52,197,196,67,202,52,31,254,63,5,0,89,60,
+  32,240,0,127,248,255,139,102,150,97,98,41,5,154,98,94,
+  57,166,25,84,90,73,102,213,150,73,165,149,84,92,57,229,
+  153,82,98,41,37,154,81,102,25,133,150,80,106,9,228,166,
+  139,178,217,245,255,251,240,255,52,0,90,52,29,240,232,126,
+  248,255,137,7,82,121,32,149,7,82,121,32,93,203,218,236,
+  177,54,123,172,205,30,107,179,199,218,236,177,54,123,172,185,
+  15,40,242,128,34,15,40,242,128,250,240,127,7,0,91,22,
+  19,240,152,126,248,231,147,74,170,184,250,255,255,255,255,185,
+  164,178,15,1,92,42,19,240,152,126,248,135,8,156,65,2,
+  39,72,224,12,18,56,65,2,39,72,224,12,18,56,65,2,
+  103,144,192,9,18,56,65,2,103,144,124,248,12,0,93,21,
+  20,240,160,126,248,15,166,149,94,253,255,255,255,255,173,220,
+  135,6,0,94,107,48,240,128,127,248,255,255,255,119,200,7,
+  141,124,208,200,7,204,124,176,204,7,75,8,241,129,26,98,
+  124,144,134,24,31,160,65,196,7,104,144,241,193,25,100,124,
+  96,166,15,202,48,227,131,34,144,248,128,12,52,62,24,3,
+  141,15,134,80,226,3,49,212,248,32,12,53,62,0,131,13,
+  63,216,240,131,141,62,220,224,195,13,46,160,216,3,14,61,
+  224,200,67,14,60,228,192,67,142,15,255,255,7,1,95,19,
+  24,240,192,126,248,255,255,255,255,151,31,248,1,246,225,53,
+  0,96,23,11,240,88,126,184,89,14,57,229,16,68,208,72,
+  3,17,52,62,252,127,30,0,97,66,26,240,208,126,248,255,
+  255,2,107,79,61,32,144,57,5,149,84,14,81,197,148,69,
+  44,213,154,122,32,160,7,198,65,166,24,147,138,41,170,148,
+  178,74,41,171,148,178,74,41,202,148,162,140,41,7,153,23,
+  8,98,130,164,68,202,135,255,101,0,98,75,28,240,224,126,
+  248,255,98,185,245,191,145,86,9,45,61,80,16,58,5,157,
+  84,142,89,228,152,85,76,97,197,148,70,76,105,196,148,70,
+  76,105,196,148,70,76,105,196,148,70,76,105,196,20,86,76,
+  97,228,24,85,206,65,5,33,99,208,3,36,149,192,84,25,
+  232,195,255,5,0,99,49,25,240,200,126,248,255,127,102,53,
+  167,30,8,168,28,99,74,42,166,40,98,200,34,165,44,82,
+  10,173,191,69,12,89,196,148,84,76,73,229,84,233,129,160,
+  92,83,31,254,7,1,100,76,28,240,224,126,248,255,141,114,
+  235,191,149,70,73,76,20,228,66,57,198,164,83,16,50,69,
+  29,83,150,49,132,153,82,152,41,165,149,82,90,41,165,149,
+  82,90,41,165,149,82,90,41,165,21,67,152,49,101,25,83,
+  212,57,37,29,84,76,74,15,16,197,66,97,104,148,15,255,
+  211,0,101,60,26,240,208,126,248,255,255,196,106,110,61,16,
+  146,57,5,17,85,76,89,196,16,86,10,97,133,20,86,200,
+  3,135,60,112,200,3,135,148,90,179,132,149,66,88,41,69,
+  149,83,82,65,229,148,244,64,96,205,169,15,255,7,102,28,
+  17,240,136,126,248,123,233,40,179,76,97,164,17,86,15,61,
+  241,153,194,234,255,255,62,252,56,0,103,90,28,240,224,126,
+  248,255,255,93,37,74,106,161,160,7,202,49,7,29,162,142,
+  41,203,24,194,76,41,204,148,210,74,41,173,148,210,74,41,
+  173,148,210,74,41,173,148,210,74,41,173,24,194,140,41,203,
+  152,162,206,41,8,157,83,18,114,161,168,37,10,59,132,96,
+  234,148,85,78,89,229,20,85,82,149,78,49,235,129,224,152,
+  68,31,230,1,104,75,27,240,216,126,248,255,66,177,245,63,
+  161,84,9,13,61,64,16,50,230,152,84,78,89,197,148,85,
+  76,89,197,148,85,76,89,197,148,85,76,89,197,148,85,76,
+  89,197,148,85,76,89,197,148,85,76,89,197,148,85,76,89,
+  197,148,85,76,89,197,148,85,76,89,229,195,255,26,0,105,
+  20,11,240,88,126,120,184,152,218,135,106,49,245,255,255,251,
+  112,22,0,106,24,14,240,112,126,248,181,146,106,31,230,74,
+  170,255,255,255,207,156,99,80,249,32,2,107,69,24,240,192,
+  126,248,191,87,102,253,15,153,82,142,49,197,152,83,138,65,
+  133,152,84,72,81,101,148,85,68,97,37,148,166,92,122,202,
+  173,86,130,97,69,152,85,70,89,101,24,85,136,73,165,24,
+  84,76,65,197,152,83,142,49,5,153,82,82,249,240,31,1,
+  108,17,11,240,88,126,120,184,152,250,255,255,255,239,195,89,
+  0,109,90,43,240,88,127,248,255,255,255,191,82,70,50,105,
+  149,192,8,75,15,16,225,16,50,37,16,83,144,73,39,149,
+  99,210,73,229,148,85,22,57,101,149,69,78,89,101,145,83,
+  86,101,202,170,76,89,149,41,171,50,101,85,166,172,202,148,
+  85,153,178,42,83,86,101,202,170,76,89,149,41,171,50,101,
+  85,166,172,202,148,85,125,248,255,31,4,110,72,27,240,216,
+  126,248,255,255,110,17,74,149,192,210,3,4,157,99,165,114,
+  202,42,166,172,98,202,42,166,172,98,202,42,166,172,98,202,
+  42,166,172,98,202,42,166,172,98,202,42,166,172,98,202,42,
+  166,172,98,202,42,166,172,98,202,42,166,172,98,202,42,31,
+  254,47,1,111,69,28,240,224,126,248,255,255,97,5,93,123,
+  32,172,114,76,42,201,156,178,202,41,172,24,210,74,41,142,
+  148,226,72,41,142,148,226,72,41,142,148,226,72,41,142,148,
+  226,136,33,173,152,194,138,41,171,160,146,76,42,199,172,7,
+  66,115,80,125,248,191,14,0,112,76,28,240,224,126,248,255,
+  255,201,50,210,42,161,165,7,10,66,199,156,147,202,49,171,
+  24,179,138,41,141,152,210,74,41,173,148,210,74,41,173,148,
+  210,74,41,173,148,210,74,41,173,148,210,74,49,171,24,179,
+  138,57,169,28,116,204,121,160,160,18,90,42,35,173,114,235,
+  223,135,67,0,113,75,28,240,224,126,248,255,255,221,52,74,
+  98,162,160,7,202,49,7,157,146,142,41,203,152,178,76,41,
+  173,148,210,74,41,173,148,210,74,41,173,148,210,74,41,173,
+  148,210,74,41,173,148,210,138,41,203,152,178,204,41,233,28,
+  115,16,122,160,164,22,202,74,163,220,250,239,195,44,0,114,
+  26,17,240,136,126,248,255,120,25,133,148,112,72,71,18,58,
+  202,172,194,234,255,239,195,175,1,115,54,24,240,192,126,248,
+  255,63,181,152,75,15,132,83,29,146,200,33,137,28,146,200,
+  33,180,76,20,151,107,173,61,37,205,44,148,148,162,72,41,
+  138,148,146,138,41,199,152,7,4,122,107,125,248,159,0,116,
+  26,16,240,128,126,248,111,134,54,86,189,227,132,103,202,170,
+  255,127,44,157,132,208,135,239,2,117,73,27,240,216,126,248,
+  255,255,205,178,138,41,171,152,178,138,41,171,152,178,138,41,
+  171,152,178,138,41,171,152,178,138,41,171,152,178,138,41,171,
+  152,178,138,41,171,152,178,138,41,171,152,178,138,41,171,152,
+  178,202,41,201,28,115,14,122,128,160,22,138,82,162,124,248,
+  95,3,118,62,26,240,208,126,248,255,255,106,113,69,20,71,
+  72,97,133,20,86,74,89,196,20,85,76,81,4,213,16,81,
+  229,16,85,76,81,197,16,86,10,97,133,16,71,8,113,69,
+  148,71,4,129,37,16,152,36,54,13,53,180,124,248,31,2,
+  119,113,39,240,56,127,248,255,255,255,15,20,117,22,17,69,
+  29,85,6,81,71,149,65,212,81,132,20,68,2,65,165,16,
+  68,2,65,196,16,68,2,65,196,20,67,6,49,229,16,67,
+  6,49,4,17,67,6,49,4,21,82,8,41,36,17,66,10,
+  33,68,17,66,10,33,68,17,66,12,25,100,17,65,14,17,
+  132,17,65,14,17,132,17,65,208,16,164,161,132,28,74,200,
+  161,132,158,89,6,154,101,160,89,38,146,70,62,252,255,81,
+  0,120,66,26,240,208,126,248,255,255,172,89,165,148,85,76,
+  73,229,152,83,82,49,101,149,66,90,25,165,153,80,94,9,
+  36,162,121,166,161,102,162,168,94,17,197,145,97,88,33,101,
+  21,83,82,57,6,21,100,76,81,165,20,86,70,105,230,195,
+  127,29,0,121,72,26,240,208,126,248,255,255,106,113,69,20,
+  71,72,97,133,20,86,74,89,196,20,85,76,81,4,213,165,
+  114,136,42,166,44,98,202,42,133,176,66,74,43,131,184,34,
+  202,43,161,188,18,72,76,17,73,52,207,52,181,170,164,150,
+  74,106,85,73,45,149,88,242,33,15,0,122,46,22,240,176,
+  126,248,255,31,122,64,148,7,68,121,64,196,2,11,52,207,
+  192,10,154,103,96,5,205,51,176,130,230,25,88,197,7,6,
+  121,96,144,7,198,135,127,9,0,123,47,24,240,192,126,248,
+  191,81,226,129,232,25,89,205,50,9,165,255,102,153,100,150,
+  104,32,130,39,158,136,164,161,133,18,90,40,253,143,22,74,
+  104,153,102,162,120,102,225,0,124,17,16,240,128,126,248,186,
+  112,242,255,255,255,255,255,223,1,125,48,24,240,192,126,248,
+  223,45,243,68,52,205,44,148,208,66,233,127,180,80,66,11,
+  53,18,197,11,34,104,98,153,100,150,73,40,253,55,203,36,
+  179,72,243,16,60,177,124,128,0,126,28,26,240,208,126,248,
+  255,255,255,214,73,132,180,97,198,3,103,20,210,70,73,231,
+  195,255,255,28,0,160,12,14,240,112,126,248,255,255,63,14,
+  0,161,21,18,240,144,126,248,255,241,210,234,62,84,74,171,
+  255,255,127,31,116,0,162,90,26,240,208,126,248,255,175,8,
+  60,174,184,211,21,112,53,183,30,8,170,148,131,74,25,129,
+  160,82,132,40,135,24,33,138,41,101,180,82,132,43,69,184,
+  66,134,43,100,184,66,196,43,99,188,50,198,43,67,192,50,
+  68,41,135,136,81,202,41,65,152,114,74,16,165,164,67,140,
+  122,172,57,5,5,22,119,92,129,197,29,57,124,120,18,0,
+  163,51,27,240,216,126,248,127,49,212,229,222,122,64,36,115,
+  12,42,169,156,178,138,41,171,152,98,235,205,7,194,122,32,
+  172,7,130,43,182,254,127,243,1,68,30,64,228,1,244,225,
+  127,12,0,164,83,30,240,240,126,248,255,139,193,134,50,232,
+  40,67,142,51,138,41,35,13,161,196,88,15,140,102,136,113,
+  4,145,70,20,97,211,26,110,168,225,134,26,110,168,225,134,
+  26,110,168,225,134,26,110,172,193,6,35,138,52,130,72,59,
+  228,172,7,74,34,66,137,145,70,49,101,156,33,135,17,84,
+  124,248,255,191,6,0,165,66,28,240,224,126,248,255,94,129,
+  69,148,103,70,113,133,20,87,74,97,197,20,86,78,81,5,
+  21,85,82,65,69,21,84,22,57,229,40,163,132,42,75,44,
+  178,80,25,5,22,81,34,9,69,170,137,214,3,75,60,176,
+  88,185,245,255,62,252,31,1,166,21,16,240,128,126,248,121,
+  225,228,255,127,31,22,133,147,255,255,125,128,1,167,70,22,
+  240,176,126,248,111,171,197,82,67,229,8,68,98,93,180,224,
+  129,232,33,136,216,74,14,21,98,76,101,8,34,165,160,66,
+  10,34,165,32,82,202,41,197,148,114,78,48,168,41,229,50,
+  120,69,19,139,164,139,197,132,84,206,40,6,181,196,218,249,
+  48,13,0,168,16,14,240,112,126,248,157,66,116,164,124,248,
+  255,223,6,169,139,42,240,80,127,248,255,191,204,248,3,1,
+  63,80,170,81,102,18,72,34,145,228,141,131,206,104,195,48,
+  51,214,40,175,16,53,200,33,166,140,52,74,65,196,12,52,
+  72,81,164,12,36,74,81,196,136,51,74,81,196,76,133,212,
+  97,132,33,86,24,81,138,21,70,148,98,133,17,134,88,97,
+  132,33,86,24,97,136,21,102,20,178,136,25,71,148,162,136,
+  17,72,148,146,138,17,104,148,130,136,25,73,24,67,140,17,
+  106,148,103,198,26,134,153,209,198,65,103,188,65,71,28,114,
+  76,226,72,53,200,224,7,2,103,31,254,255,231,0,170,54,
+  19,240,152,126,248,15,28,181,16,25,228,76,102,156,1,39,
+  149,14,51,134,12,51,206,40,3,141,50,208,40,227,144,50,
+  14,49,100,152,131,194,64,70,144,15,250,3,66,60,32,62,
+  252,255,22,0,171,62,27,240,216,126,248,255,255,39,73,33,
+  141,20,210,136,33,141,20,210,72,41,172,20,210,72,33,141,
+  148,194,74,33,141,20,226,74,33,142,148,226,72,33,174,20,
+  226,72,41,142,20,226,136,33,142,20,242,72,33,31,254,63,
+  1,0,172,25,30,240,240,126,248,255,255,127,227,129,69,30,
+  88,228,129,181,231,239,195,255,255,167,0,174,146,42,240,80,
+  127,248,255,191,204,248,3,1,63,80,170,81,102,18,72,34,
+  17,140,144,55,136,35,163,141,242,200,88,164,12,84,6,81,
+  195,12,53,200,72,227,12,53,202,64,227,12,53,202,64,2,
+  13,53,140,56,3,141,68,204,132,6,34,103,24,145,92,18,
+  70,36,182,132,17,201,37,97,68,26,136,32,97,68,154,144,
+  48,34,77,72,152,129,70,26,103,28,129,70,26,71,32,129,
+  134,26,70,160,113,134,26,101,36,113,134,26,69,168,97,134,
+  26,100,44,97,134,26,99,52,129,197,19,117,196,33,199,28,
+  112,212,162,10,126,32,112,246,225,255,127,14,0,175,16,14,
+  240,112,126,248,213,7,30,96,31,254,255,183,1,176,34,15,
+  240,120,126,248,241,146,206,25,99,20,97,6,17,71,16,113,
+  4,17,71,144,81,166,49,206,73,229,195,255,127,2,0,177,
+  78,49,240,136,127,248,255,255,255,31,28,31,188,241,193,27,
+  31,188,241,193,27,31,188,241,193,27,31,188,241,193,27,31,
+  136,7,28,125,192,209,7,220,7,98,124,240,198,7,111,124,
+  240,198,7,111,124,240,198,7,111,124,240,198,7,111,124,248,
+  243,15,56,250,128,163,15,184,15,255,255,183,1,178,32,17,
+  240,136,126,248,91,8,173,194,10,33,133,12,67,26,197,72,
+  35,171,110,145,85,49,55,188,15,255,127,16,0,179,41,18,
+  240,144,126,248,219,233,48,211,8,41,133,140,67,28,197,138,
+  58,171,52,228,8,28,100,160,65,6,26,132,148,66,154,89,
+  233,124,248,255,55,1,180,22,12,240,96,126,120,168,28,114,
+  202,161,208,64,228,16,52,62,252,255,57,0,182,118,27,240,
+  216,126,248,255,206,83,15,136,132,138,88,169,8,165,138,72,
+  171,136,180,138,72,171,136,180,138,72,171,136,180,138,72,171,
+  136,180,138,72,171,8,165,138,88,169,8,134,138,120,165,8,
+  41,138,144,162,8,41,138,144,162,8,41,138,144,162,8,41,
+  138,144,162,8,41,138,144,162,8,41,138,144,162,8,41,138,
+  144,162,8,41,138,144,162,8,41,138,144,162,8,41,138,144,
+  162,8,41,138,144,162,8,41,138,144,162,8,41,138,248,112,
+  17,0,183,15,13,240,104,126,248,127,164,160,122,31,254,231,
+  0,184,25,14,240,112,126,248,255,255,25,193,36,118,14,82,
+  69,145,53,9,81,200,80,4,73,0,185,22,14,240,112,126,
+  248,53,146,10,50,231,28,33,198,154,255,239,195,255,59,0,
+  186,58,21,240,168,126,248,159,48,77,41,66,8,34,134,156,
+  129,134,33,136,148,161,70,25,106,148,161,70,25,106,148,161,
+  70,25,106,20,130,136,25,104,28,98,8,34,132,40,213,204,
+  135,214,3,130,60,32,62,252,255,3,187,62,27,240,216,126,
+  248,255,255,199,72,33,142,24,226,72,33,143,20,226,136,33,
+  142,20,226,74,33,142,148,226,72,41,173,20,210,72,41,172,
+  144,194,74,33,141,20,210,136,33,141,20,210,72,33,141,24,
+  210,72,33,31,254,63,4,0,188,121,39,240,56,127,248,255,
+  95,29,145,188,1,139,27,239,184,241,70,24,109,64,33,6,
+  35,116,176,81,199,34,117,172,97,135,26,119,168,113,71,26,
+  120,164,129,7,26,121,160,145,199,25,122,24,162,135,25,136,
+  188,81,70,34,111,148,129,138,29,200,216,129,76,29,104,132,
+  81,7,26,97,208,129,134,24,147,156,49,198,28,72,144,33,
+  201,25,100,200,113,70,25,113,160,7,2,27,232,129,176,70,
+  122,32,172,17,199,27,114,56,34,135,27,115,124,248,255,155,
+  0,189,112,39,240,56,127,248,255,159,29,144,60,242,202,27,
+  238,184,241,70,24,110,60,33,70,27,116,48,66,7,27,117,
+  44,82,199,26,118,168,113,135,26,119,164,129,7,34,120,160,
+  145,199,33,121,156,161,135,25,199,184,97,70,81,108,148,97,
+  214,28,133,144,18,135,25,134,64,82,136,33,112,64,242,6,
+  44,111,64,242,6,36,112,184,2,135,43,144,180,18,71,35,
+  114,176,50,199,42,115,48,167,6,115,105,52,247,225,255,207,
+  1,190,125,39,240,56,127,248,255,31,38,44,185,177,24,35,
+  171,173,177,136,33,138,172,113,136,26,150,164,97,73,34,242,
+  168,49,141,34,19,161,129,201,33,122,152,1,7,26,101,196,
+  129,6,33,145,148,66,134,108,132,80,85,198,33,235,152,129,
+  8,30,167,220,113,140,37,102,132,97,199,25,97,84,98,134,
+  24,117,152,49,6,29,71,144,65,135,25,100,204,97,70,25,
+  146,148,97,134,28,230,129,208,136,121,32,180,113,30,8,108,
+  196,1,71,28,111,200,225,136,28,31,254,255,34,0,191,44,
+  25,240,200,126,248,255,255,74,161,117,31,54,72,165,71,203,
+  172,164,37,203,172,40,161,117,108,20,163,74,57,167,152,7,
+  200,121,64,164,199,216,59,31,170,0,192,114,36,240,32,127,
+  136,150,15,66,249,32,144,15,4,249,32,144,15,4,249,64,
+  144,15,196,248,96,140,15,95,54,222,116,196,209,78,91,105,
+  18,74,46,162,96,50,202,45,164,216,66,74,45,165,212,98,
+  10,37,167,204,130,138,44,168,196,162,10,44,170,64,178,202,
+  43,172,184,194,74,123,32,177,7,210,122,64,173,7,150,34,
+  146,164,34,11,42,178,156,66,139,41,180,24,82,75,41,182,
+  144,98,203,40,184,136,130,203,135,255,31,1,193,113,36,240,
+  32,127,24,40,190,124,0,200,7,128,124,16,200,7,128,124,
+  0,200,7,97,124,16,198,135,79,27,111,58,226,104,167,173,
+  52,9,37,23,81,48,25,229,22,82,108,33,165,150,82,106,
+  49,133,146,83,102,65,69,22,84,98,81,5,22,85,32,89,
+  229,21,86,92,97,165,61,144,216,3,105,61,160,214,3,75,
+  17,73,82,145,5,21,89,78,161,197,20,90,12,169,165,20,
+  91,72,177,101,20,92,68,193,229,195,255,143,0,194,111,36,
+  240,32,127,40,27,111,58,226,104,19,65,52,17,36,19,66,
+  240,48,227,14,52,62,124,212,120,211,17,71,59,109,165,73,
+  40,185,136,130,201,40,183,144,98,11,41,181,148,82,139,41,
+  148,156,50,11,42,178,160,18,139,42,176,168,2,201,42,175,
+  176,226,10,43,237,129,196,30,72,235,1,181,30,88,138,72,
+  146,138,44,168,200,114,10,45,166,208,98,72,45,165,216,66,
+  138,45,163,224,34,10,46,31,254,127,4,0,195,105,36,240,
+  32,127,248,78,33,227,34,49,46,187,67,160,59,72,249,240,
+  219,198,155,142,56,218,105,43,77,66,201,69,20,76,70,185,
+  133,20,91,72,169,165,148,90,76,161,228,148,89,80,145,5,
+  149,88,84,129,69,21,72,86,121,133,21,87,88,105,15,36,
+  246,64,90,15,168,245,192,82,68,146,84,100,65,69,150,83,
+  104,49,133,22,67,106,41,197,22,82,108,25,5,23,81,112,
+  249,240,255,35,0,196,106,36,240,32,127,248,76,33,197,22,
+  82,108,33,197,22,82,108,33,229,195,47,23,111,252,225,136,
+  39,173,116,9,37,19,81,112,25,4,151,81,108,33,197,150,
+  82,42,49,133,150,83,38,65,69,150,68,100,73,5,22,85,
+  96,89,229,17,86,92,105,165,61,128,216,3,137,61,160,212,
+  3,75,149,88,18,145,5,149,89,78,153,197,148,74,76,169,
+  165,16,91,72,185,101,148,91,68,193,230,195,255,111,0,197,
+  113,36,240,32,191,226,15,31,99,232,81,70,22,71,100,113,
+  68,22,71,100,97,134,30,99,240,227,203,135,47,155,126,58,
+  226,104,43,173,114,9,37,23,81,110,25,229,22,82,108,33,
+  165,150,82,106,49,101,150,83,102,65,69,146,84,98,81,5,
+  22,85,94,89,229,21,86,90,213,30,72,236,129,180,30,88,
+  234,129,149,138,36,169,200,130,200,44,167,208,98,72,45,165,
+  88,82,138,45,163,220,50,10,46,162,224,242,225,255,71,0,
+  198,122,47,240,120,127,248,255,255,219,15,168,250,192,170,15,
+  44,250,0,163,234,131,82,66,249,160,148,80,62,32,69,148,
+  15,72,17,229,131,81,125,48,170,15,68,33,229,131,96,72,
+  249,32,148,82,62,0,166,148,15,64,49,15,24,103,204,3,
+  198,149,243,128,105,230,60,96,90,65,133,27,84,248,3,100,
+  63,80,246,3,69,63,96,116,89,37,23,86,114,97,5,151,
+  86,112,105,229,22,87,172,113,15,156,82,222,3,135,152,247,
+  192,33,5,62,112,62,252,255,47,3,199,74,32,240,0,127,
+  248,255,237,53,223,123,128,176,7,202,58,201,168,210,10,42,
+  174,160,242,200,41,144,156,2,201,33,156,236,250,31,167,241,
+  2,9,34,144,160,226,74,42,173,36,163,204,122,160,180,7,
+  200,123,178,97,225,37,111,52,226,164,147,62,81,81,10,93,
+  53,125,136,1,200,60,29,240,232,126,136,148,76,114,201,68,
+  19,61,52,165,199,135,103,30,56,231,129,115,30,56,231,129,
+  115,10,174,255,240,3,6,61,96,208,3,6,61,96,80,193,
+  245,63,252,192,57,15,156,243,192,57,15,156,15,255,135,0,
+  201,59,29,240,232,126,168,149,91,48,193,5,83,121,202,228,
+  195,59,15,156,243,192,57,15,156,243,192,57,5,215,127,248,
+  1,131,30,48,232,1,131,30,48,168,224,250,31,126,224,156,
+  7,206,121,224,156,7,206,135,255,67,0,202,68,29,240,232,
+  126,8,149,123,236,169,137,146,64,38,25,68,142,50,226,56,
+  3,142,51,62,60,241,192,57,15,156,243,192,57,15,156,83,
+  112,253,135,31,48,232,1,131,30,48,232,1,131,10,174,255,
+  225,7,206,121,224,156,7,206,121,224,124,248,63,4,0,203,
+  63,29,240,232,126,56,94,74,113,165,20,87,74,113,165,20,
+  87,74,249,240,252,3,231,60,112,206,3,231,60,112,78,193,
+  245,31,126,192,160,7,12,122,192,160,7,12,42,184,254,135,
+  31,56,231,129,115,30,56,231,129,243,225,255,16,0,204,27,
+  12,240,96,98,130,42,68,18,65,36,145,52,212,248,80,41,
+  167,254,255,255,255,251,240,8,0,205,26,13,240,104,126,48,
+  10,162,80,65,84,154,212,248,80,43,168,254,255,255,255,251,
+  240,36,0,206,33,13,240,104,250,114,204,57,5,21,18,200,
+  32,99,34,36,12,51,194,56,227,67,167,160,250,255,255,255,
+  239,195,147,0,207,31,15,240,120,126,168,21,82,66,33,37,
+  20,82,66,33,37,20,82,62,76,20,85,255,255,255,255,125,
+  248,30,0,208,103,34,240,16,127,248,255,87,223,124,128,188,
+  7,76,123,224,176,162,208,42,236,168,226,76,42,175,164,2,
+  11,42,176,160,18,203,41,177,156,18,203,41,146,156,34,201,
+  120,64,40,50,30,16,138,140,7,132,42,226,1,161,200,41,
+  146,156,34,201,41,146,156,18,203,41,177,156,18,9,42,176,
+  160,242,12,42,175,164,226,76,42,236,168,162,208,122,224,176,
+  7,76,123,128,188,247,225,255,187,0,209,133,35,240,24,127,
+  248,66,33,195,34,49,108,171,36,32,59,10,249,240,83,231,
+  21,116,94,65,200,21,148,90,65,169,21,164,88,65,138,21,
+  180,86,65,37,148,85,80,9,70,21,84,68,81,5,21,97,
+  82,65,101,24,84,13,131,42,98,78,65,165,148,83,80,41,
+  198,20,84,76,133,138,49,165,160,114,74,41,168,28,67,10,
+  42,200,140,130,10,50,163,160,146,140,40,168,168,34,10,42,
+  202,132,130,202,42,161,160,178,22,42,76,161,194,20,42,45,
+  161,210,18,42,14,161,242,14,42,239,124,248,255,50,0,210,
+  117,37,240,40,127,8,151,15,66,249,64,148,15,4,249,96,
+  144,15,198,248,96,144,15,6,249,96,140,15,223,110,246,1,
+  49,31,32,241,1,243,204,50,205,90,6,22,85,98,73,101,
+  22,84,102,65,164,18,68,42,57,165,22,83,106,49,165,22,
+  83,106,49,165,22,83,106,49,165,22,83,106,49,165,22,83,
+  106,57,164,18,68,42,65,101,22,84,102,73,68,22,85,98,
+  89,229,149,86,154,105,39,157,247,128,137,15,16,250,240,250,
+  240,255,235,0,211,117,37,240,40,127,88,40,31,132,242,1,
+  40,31,4,242,65,32,31,136,241,129,32,31,4,242,129,24,
+  31,190,222,236,3,98,62,64,226,3,230,153,101,154,181,12,
+  44,170,196,146,202,44,168,204,130,72,37,136,84,114,74,45,
+  166,212,98,74,45,166,212,98,74,45,166,212,98,74,45,166,
+  212,98,74,45,166,212,114,72,37,136,84,130,202,44,168,204,
+  146,136,44,170,196,178,202,43,173,52,211,78,58,239,1,19,
+  31,32,244,225,245,225,255,215,1,212,115,37,240,40,127,136,
+  151,15,192,241,167,39,78,2,217,100,16,61,202,200,196,12,
+  60,206,248,240,221,102,31,16,243,1,18,31,48,207,44,211,
+  172,101,96,81,37,150,84,102,65,101,22,68,42,65,164,146,
+  83,106,49,165,22,83,106,49,165,22,83,106,49,165,22,83,
+  106,49,165,22,83,106,49,165,150,67,42,65,164,18,84,102,
+  65,101,150,68,100,81,37,150,85,94,105,165,153,118,210,121,
+  15,152,248,0,161,15,175,15,255,191,14,0,213,108,37,240,
+  40,127,248,26,41,3,31,49,112,195,67,28,60,10,249,240,
+  7,154,125,64,204,7,72,124,192,60,179,76,179,150,129,69,
+  149,88,82,153,5,149,89,16,169,4,145,74,78,169,197,148,
+  90,76,169,197,148,90,76,169,197,148,90,76,169,197,148,90,
+  76,169,197,148,90,14,169,4,145,74,80,153,5,149,89,18,
+  145,69,149,88,86,121,165,149,102,218,73,231,61,96,226,3,
+  132,62,188,62,252,255,58,0,214,109,37,240,40,127,248,86,
+  41,197,150,82,108,41,197,150,82,108,41,229,195,111,55,251,
+  128,152,15,144,248,128,121,102,153,102,45,3,139,42,177,164,
+  50,11,42,179,32,82,9,34,149,156,82,139,41,181,152,82,
+  139,41,181,152,82,139,41,181,152,82,139,41,181,152,82,139,
+  41,181,28,82,9,34,149,160,50,11,42,179,36,34,139,42,
+  177,172,242,74,43,205,180,147,206,123,192,196,7,8,125,120,
+  125,248,255,117,0,215,89,48,240,128,127,248,255,255,255,127,
+  81,80,113,137,36,151,64,146,137,35,155,48,210,137,34,31,
+  0,130,200,7,130,24,242,1,161,62,48,68,144,15,16,250,
+  64,153,15,24,249,128,153,15,20,250,0,17,65,62,48,132,
+  144,15,8,49,228,3,65,16,249,0,16,69,58,97,100,19,
+  71,50,129,228,18,73,174,160,226,195,255,255,111,2,216,137,
+  37,240,40,127,248,255,123,226,131,65,62,16,229,3,80,96,
+  19,229,61,112,220,3,199,61,128,154,89,135,25,118,150,97,
+  73,149,150,82,105,37,20,84,152,9,5,145,86,6,65,132,
+  21,82,76,89,134,20,83,86,41,197,20,85,76,149,140,169,
+  82,57,197,20,84,153,114,12,42,166,156,146,138,169,84,49,
+  165,24,85,76,41,101,17,68,72,97,4,21,97,86,65,69,
+  20,86,18,9,133,21,165,88,89,136,21,118,88,113,39,29,
+  247,192,113,15,28,247,128,129,69,176,88,62,8,228,131,80,
+  62,24,226,195,127,16,0,217,121,35,240,24,127,104,150,15,
+  0,249,0,148,15,64,249,0,144,15,2,249,32,140,15,196,
+  248,32,140,15,31,42,178,156,34,203,41,178,156,34,203,41,
+  178,156,34,203,41,178,156,34,203,41,178,156,34,203,41,178,
+  156,34,203,41,178,156,34,203,41,178,156,34,203,41,178,156,
+  34,203,41,178,156,34,203,41,146,160,34,9,42,146,160,34,
+  9,42,146,36,18,75,34,177,164,2,137,42,175,172,210,204,
+  58,202,180,7,204,123,160,192,7,4,109,31,254,127,1,0,
+  218,112,35,240,24,127,136,151,94,121,234,3,64,60,249,0,
+  140,15,192,248,240,169,34,203,41,178,156,34,203,41,178,156,
+  34,203,41,178,156,34,203,41,178,156,34,203,41,178,156,34,
+  203,41,178,156,34,203,41,178,156,34,203,41,178,156,34,203,
+  41,178,156,34,203,41,178,156,34,9,42,146,160,34,9,42,
+  146,160,34,73,34,177,36,18,75,42,144,168,242,202,42,205,
+  172,163,76,123,192,188,7,10,124,64,208,246,225,255,23,0,
+  219,117,35,240,24,127,232,22,111,248,217,73,147,80,48,25,
+  4,143,66,44,49,195,14,52,62,124,163,200,114,138,44,167,
+  200,114,138,44,167,200,114,138,44,167,200,114,138,44,167,200,
+  114,138,44,167,200,114,138,44,167,200,114,138,44,167,200,114,
+  138,44,167,200,114,138,44,167,200,114,138,44,167,72,130,138,
+  36,168,72,130,138,36,168,72,146,72,44,137,196,146,10,36,
+  170,188,178,74,51,235,40,211,30,48,239,129,2,31,16,180,
+  125,248,255,5,0,220,110,35,240,24,127,248,145,82,10,45,
+  165,208,82,10,45,165,124,248,153,34,203,41,178,156,34,203,
+  41,178,156,34,203,41,178,156,34,203,41,178,156,34,203,41,
+  178,156,34,203,41,178,156,34,203,41,178,156,34,203,41,178,
+  156,34,203,41,178,156,34,203,41,178,156,34,9,42,146,160,
+  34,9,42,146,160,34,73,34,177,36,18,75,42,144,168,242,
+  202,42,205,172,163,76,123,192,188,7,10,124,64,208,246,225,
+  255,23,0,221,69,32,240,0,127,168,146,93,116,217,20,39,
+  155,240,233,195,171,102,150,97,98,41,5,154,98,94,57,166,
+  25,84,90,73,102,213,150,73,165,149,84,92,57,229,153,82,
+  98,41,37,154,81,102,25,133,150,80,106,9,228,166,139,178,
+  217,245,255,251,240,255,52,0,222,69,30,240,240,126,248,255,
+  205,146,235,229,247,30,24,236,129,162,30,48,169,36,132,202,
+  50,168,176,130,74,43,167,180,114,74,43,167,180,114,74,43,
+  167,180,114,74,43,167,176,130,202,50,168,36,132,30,48,233,
+  129,162,30,24,236,189,146,235,247,225,255,33,0,223,100,28,
+  240,224,126,248,127,90,65,215,30,8,234,24,147,42,84,22,
+  65,101,17,84,22,65,101,17,84,84,65,37,85,199,168,98,
+  204,42,197,176,82,74,43,133,184,82,136,43,165,180,82,12,
+  43,230,168,114,16,42,40,153,162,80,41,204,148,210,12,41,
+  174,144,242,8,41,175,140,34,10,34,164,136,130,8,41,131,
+  32,66,202,48,165,144,66,92,41,133,153,114,210,135,255,195,
+  0,224,74,26,240,208,126,248,63,64,108,101,201,37,119,224,
+  233,195,89,214,158,122,64,32,115,10,42,169,28,162,138,41,
+  139,88,170,53,245,64,64,15,140,131,76,49,38,21,83,84,
+  41,101,149,82,86,41,101,149,82,148,41,69,25,83,14,50,
+  47,16,196,4,73,137,148,15,255,121,0,225,74,26,240,208,
+  126,248,223,42,149,102,73,37,118,186,227,195,105,214,158,122,
+  64,32,115,10,42,169,28,162,138,41,139,88,170,53,245,64,
+  64,15,140,131,76,49,38,21,83,84,41,101,149,82,86,41,
+  101,149,82,148,41,69,25,83,14,50,47,16,196,4,73,137,
+  148,15,255,121,0,226,84,26,240,208,126,248,223,49,212,76,
+  36,81,36,130,192,65,198,35,101,52,98,70,27,104,124,184,
+  201,218,83,15,8,100,78,65,37,149,67,84,49,101,17,75,
+  181,166,30,8,232,129,113,144,41,198,164,98,138,42,165,172,
+  82,202,42,165,172,82,138,50,165,40,99,202,65,230,5,130,
+  152,32,41,145,242,225,63,15,0,227,78,26,240,208,126,248,
+  127,149,148,209,144,24,141,53,18,80,27,164,124,120,144,181,
+  167,30,16,200,156,130,74,42,135,168,98,202,34,150,106,77,
+  61,16,208,3,227,32,83,140,73,197,20,85,74,89,165,148,
+  85,74,89,165,20,101,74,81,198,148,131,204,11,4,49,65,
+  82,34,229,195,127,30,0,228,77,26,240,208,126,248,127,179,
+  144,194,10,41,172,144,194,10,41,31,190,196,218,83,15,8,
+  100,78,65,37,149,67,84,49,101,17,75,181,166,30,8,232,
+  129,113,144,41,198,164,98,138,42,165,172,82,202,42,165,172,
+  82,138,50,165,40,99,202,65,230,5,130,152,32,41,145,242,
+  225,63,15,0,229,88,26,240,208,126,248,39,73,53,83,16,
+  17,133,17,80,24,1,133,17,80,24,1,133,17,81,16,49,
+  77,37,31,14,179,246,212,3,2,153,83,80,73,229,16,85,
+  76,89,196,82,173,169,7,2,122,96,28,100,138,49,169,152,
+  162,74,41,171,148,178,74,41,171,148,162,76,41,202,152,114,
+  144,121,129,32,38,72,74,164,124,248,207,3,230,96,43,240,
+  88,127,248,255,255,255,191,180,144,98,143,52,245,64,24,15,
+  25,68,4,57,149,66,169,152,162,206,34,214,44,98,11,43,
+  181,52,178,30,120,64,160,7,30,40,230,129,7,78,73,167,
+  88,163,74,45,172,212,194,74,45,204,172,66,202,58,139,148,
+  178,70,24,139,148,162,72,32,169,152,130,200,32,167,156,7,
+  196,120,233,25,198,86,82,31,254,255,71,1,231,62,25,240,
+  200,126,248,255,127,102,53,167,30,8,168,28,99,74,42,166,
+  40,98,200,34,165,44,82,10,173,191,69,12,89,196,148,84,
+  76,73,229,84,233,129,160,28,91,82,92,233,154,137,42,177,
+  196,78,77,148,210,212,67,31,112,0,232,71,26,240,208,126,
+  248,223,40,182,88,114,201,29,151,186,3,143,15,135,87,115,
+  235,129,144,204,41,136,168,98,202,34,134,176,82,8,43,164,
+  176,66,30,56,228,129,67,30,56,164,212,154,37,172,20,194,
+  74,41,170,156,146,10,42,167,164,7,2,107,78,125,248,95,
+  1,233,71,26,240,208,126,248,31,35,181,208,82,41,59,44,
+  169,196,142,15,183,87,115,235,129,144,204,41,136,168,98,202,
+  34,134,176,82,8,43,164,176,66,30,56,228,129,67,30,56,
+  164,212,154,37,172,20,194,74,41,170,156,146,10,42,167,164,
+  7,2,107,78,125,248,95,1,234,79,26,240,208,126,248,223,
+  49,212,76,20,83,36,130,60,66,198,27,133,52,98,70,27,
+  104,124,56,186,154,91,15,132,100,78,65,68,21,83,22,49,
+  132,149,66,88,33,133,21,242,192,33,15,28,242,192,33,165,
+  214,44,97,165,16,86,74,81,229,148,84,80,57,37,61,16,
+  88,115,234,195,255,10,0,235,72,26,240,208,126,248,127,179,
+  144,194,10,41,172,144,194,10,41,31,62,181,154,91,15,132,
+  100,78,65,68,21,83,22,49,132,149,66,88,33,133,21,242,
+  192,33,15,28,242,192,33,165,214,44,97,165,16,86,74,81,
+  229,148,84,80,57,37,61,16,88,115,234,195,255,10,0,236,
+  27,12,240,96,126,120,161,160,130,72,162,16,73,36,13,53,
+  62,84,202,169,255,255,223,135,55,0,237,24,12,240,96,126,
+  120,168,28,234,148,67,161,9,145,15,157,250,255,255,251,240,
+  10,0,238,35,16,240,128,126,248,180,81,38,33,132,14,17,
+  196,144,65,8,41,131,12,67,196,64,227,67,185,172,250,255,
+  255,125,248,56,0,239,28,15,240,120,126,248,221,66,74,40,
+  164,132,66,74,40,164,124,88,44,170,254,255,127,31,190,7,
+  0,240,90,28,240,224,126,248,255,230,88,98,153,67,90,33,
+  5,170,121,40,146,235,149,82,24,65,133,133,85,110,121,142,
+  61,32,212,3,35,153,115,80,73,230,148,85,78,97,197,144,
+  86,74,113,164,20,71,74,113,164,20,71,74,113,164,20,71,
+  74,113,164,20,71,12,105,197,20,86,76,89,5,149,100,144,
+  57,70,61,32,154,123,235,195,255,5,0,241,84,27,240,216,
+  126,248,255,14,41,226,29,49,92,115,67,156,39,10,249,240,
+  102,17,74,149,192,210,3,4,157,99,165,114,202,42,166,172,
+  98,202,42,166,172,98,202,42,166,172,98,202,42,166,172,98,
+  202,42,166,172,98,202,42,166,172,98,202,42,166,172,98,202,
+  42,166,172,98,202,42,166,172,98,202,42,31,254,215,0,242,
+  80,28,240,224,126,248,159,47,184,96,146,9,38,153,228,161,
+  135,22,31,158,81,208,181,7,194,42,199,164,146,204,41,171,
+  156,194,138,33,173,148,226,72,41,142,148,226,72,41,142,148,
+  226,72,41,142,148,226,72,41,142,24,210,138,41,172,152,178,
+  10,42,201,164,114,204,122,32,52,7,213,135,255,11,0,243,
+  77,28,240,224,126,248,191,83,46,133,201,165,240,148,199,135,
+  135,20,116,237,129,176,202,49,169,36,115,202,42,167,176,98,
+  72,43,165,56,82,138,35,165,56,82,138,35,165,56,82,138,
+  35,165,56,82,138,35,134,180,98,10,43,166,172,130,74,50,
+  169,28,179,30,8,205,65,245,225,255,2,0,244,86,28,240,
+  224,126,248,191,81,174,169,167,162,73,4,137,100,144,56,10,
+  121,227,140,55,208,248,240,130,130,174,61,16,86,57,38,149,
+  100,78,89,229,20,86,12,105,165,20,71,74,113,164,20,71,
+  74,113,164,20,71,74,113,164,20,71,74,113,196,144,86,76,
+  97,197,148,85,80,73,38,149,99,214,3,161,57,168,62,252,
+  95,0,245,81,28,240,224,126,248,255,46,41,227,29,49,94,
+  123,67,28,56,8,249,240,5,5,93,123,32,172,114,76,42,
+  201,156,178,202,41,172,24,210,74,41,142,148,226,72,41,142,
+  148,226,72,41,142,148,226,72,41,142,148,226,136,33,173,152,
+  194,138,41,171,160,146,76,42,199,172,7,66,115,80,125,248,
+  191,0,0,246,79,28,240,224,126,248,255,106,33,197,21,82,
+  92,33,197,21,82,62,124,90,65,215,30,8,171,28,147,74,
+  50,167,172,114,10,43,134,180,82,138,35,165,56,82,138,35,
+  165,56,82,138,35,165,56,82,138,35,165,56,98,72,43,166,
+  176,98,202,42,168,36,147,202,49,235,129,208,28,84,31,254,
+  47,0,247,54,49,240,136,127,248,255,255,255,255,151,201,7,
+  205,124,192,204,7,204,124,208,200,135,31,123,192,209,7,28,
+  125,192,125,120,152,124,208,204,7,204,124,192,204,7,204,124,
+  208,200,135,255,255,255,77,0,248,94,28,240,224,126,248,255,
+  127,80,100,114,9,30,77,5,178,30,8,235,129,176,202,49,
+  169,160,115,10,66,167,160,17,138,33,136,132,82,202,33,162,
+  148,98,8,33,165,152,81,72,41,133,42,133,16,67,74,25,
+  228,144,82,6,57,164,20,65,16,49,36,16,84,12,74,197,
+  32,84,144,149,202,49,234,1,161,30,16,138,8,181,8,30,
+  121,232,240,225,143,3,249,84,27,240,216,126,248,95,44,151,
+  96,114,9,166,240,200,3,143,15,151,203,42,166,172,98,202,
+  42,166,172,98,202,42,166,172,98,202,42,166,172,98,202,42,
+  166,172,98,202,42,166,172,98,202,42,166,172,98,202,42,166,
+  172,98,202,42,166,172,98,202,42,167,36,115,204,57,232,1,
+  130,90,40,74,137,242,225,127,13,0,250,81,27,240,216,126,
+  248,95,46,150,118,137,37,119,194,227,195,237,178,138,41,171,
+  152,178,138,41,171,152,178,138,41,171,152,178,138,41,171,152,
+  178,138,41,171,152,178,138,41,171,152,178,138,41,171,152,178,
+  138,41,171,152,178,138,41,171,152,178,202,41,201,28,115,14,
+  122,128,160,22,138,82,162,124,248,95,3,251,92,27,240,216,
+  126,248,95,45,245,208,51,73,32,146,4,18,201,32,112,148,
+  241,198,25,110,32,241,225,106,89,197,148,85,76,89,197,148,
+  85,76,89,197,148,85,76,89,197,148,85,76,89,197,148,85,
+  76,89,197,148,85,76,89,197,148,85,76,89,197,148,85,76,
+  89,197,148,85,76,89,229,148,100,142,57,7,61,64,80,11,
+  69,41,81,62,252,175,1,252,84,27,240,216,126,248,255,72,
+  41,133,149,82,88,41,133,149,82,62,124,172,172,98,202,42,
+  166,172,98,202,42,166,172,98,202,42,166,172,98,202,42,166,
+  172,98,202,42,166,172,98,202,42,166,172,98,202,42,166,172,
+  98,202,42,166,172,98,202,42,166,172,114,74,50,199,156,131,
+  30,32,168,133,162,148,40,31,254,215,0,253,85,26,240,208,
+  126,248,95,35,181,208,82,41,59,44,177,211,135,155,197,21,
+  81,28,33,133,21,82,88,41,101,17,83,84,49,69,17,84,
+  151,202,33,170,152,178,74,41,171,144,194,10,41,173,12,226,
+  138,40,175,132,242,74,32,49,69,36,209,60,211,212,82,73,
+  173,42,121,130,148,86,70,113,235,169,152,102,249,176,0,0,
+  254,77,28,240,224,126,248,255,98,185,245,191,145,86,9,45,
+  61,80,16,58,230,156,84,142,89,197,152,85,76,105,196,148,
+  86,74,105,165,148,86,74,105,165,148,86,74,105,165,148,86,
+  74,105,165,148,86,138,89,197,152,85,204,73,229,160,99,206,
+  3,5,149,208,82,25,105,149,91,255,62,108,1,255,83,26,
+  240,208,126,248,127,179,144,194,10,41,172,144,194,10,41,31,
+  190,81,92,17,197,149,81,88,33,133,149,82,22,49,69,149,
+  83,82,57,37,17,84,165,114,136,42,166,172,82,202,42,133,
+  52,66,74,43,163,180,50,200,43,161,188,18,72,204,228,153,
+  103,154,90,85,82,171,74,106,169,196,146,90,42,249,144,7,
+  0,0
+};
@@ -0,0 +1,97 @@
+#include "csrc/ucg.h"
+/*
+  Fonts of the Alarm firmware with the glyphs of ../font_subset.txt.
+  This file has been generated by host/fontsubset.c (make subset), do not edit.
+*/
+/*
+  Fontname: ucg_font_fur17_hf
+  Glyphs: 13/189
+  BBX Build Mode: 1, expanded glyphs
+*/
+const ucg_fntpgm_uint8_t ucg_font_fur17_hf[1162] UCG_FONT_SECTION("ucg_font_fur17_hf") = {
+  13,129,4,2,5,5,1,4,6,23,30,255,250,17,251,17,
+  253,4,115,4,115,32,35,7,30,0,250,7,15,0,15,0,
+  15,0,15,0,15,0,15,0,15,0,15,0,15,0,15,0,
+  15,0,15,0,15,0,15,0,37,151,21,30,0,250,21,15,
+  0,15,0,15,0,15,0,15,0,15,0,15,0,15,0,15,
+  0,15,0,0,3,0,1,8,1,7,3,0,3,6,1,7,
+  3,3,2,4,2,7,2,4,2,4,1,8,2,4,2,3,
+  2,8,2,4,2,3,1,9,2,4,2,2,2,10,2,2,
+  2,2,2,12,3,0,2,2,1,3,3,0,1,12,2,2,
+  3,0,3,11,1,2,2,4,2,9,2,2,2,4,2,9,
+  1,3,2,4,2,8,1,4,2,4,2,7,2,4,2,4,
+  2,7,1,6,3,0,3,7,2,7,3,0,1,15,0,15,
+  0,15,0,15,0,15,0,15,0,15,0,15,0,9,0,45,
+  41,8,30,0,250,8,15,0,15,0,15,0,15,0,15,0,
+  15,0,15,0,15,0,15,0,10,3,0,3,15,0,15,0,
+  15,0,15,0,15,0,14,0,48,103,13,30,0,250,13,15,
+  0,15,0,15,0,15,0,15,0,15,0,5,3,0,1,8,
+  3,0,3,0,1,5,2,4,2,5,2,5,2,3,2,6,
+  2,3,2,6,2,3,2,6,2,3,2,6,2,3,2,6,
+  2,3,2,6,2,3,2,6,2,3,2,6,2,3,2,6,
+  2,4,2,4,3,4,2,4,2,6,3,0,3,0,1,7,
+  3,0,1,15,0,15,0,15,0,15,0,15,0,8,0,49,
+  71,13,30,0,250,13,15,0,15,0,15,0,15,0,15,0,
+  15,0,6,3,9,3,0,1,8,3,0,2,8,2,1,2,
+  11,2,11,2,11,2,11,2,11,2,11,2,11,2,11,2,
+  11,2,11,2,11,2,11,2,11,2,15,0,15,0,15,0,
+  15,0,15,0,8,0,50,83,13,30,0,250,13,15,0,15,
+  0,15,0,15,0,15,0,15,0,5,3,0,1,7,3,0,
+  3,0,2,5,2,4,2,4,3,5,2,3,3,5,2,11,
+  2,10,3,9,3,10,3,9,3,9,3,9,3,9,3,9,
+  3,10,2,10,3,10,3,0,3,0,3,0,1,15,0,15,
+  0,15,0,15,0,15,0,5,0,51,89,13,30,0,250,13,
+  15,0,15,0,15,0,15,0,15,0,15,0,5,3,0,2,
+  6,3,0,3,0,2,5,2,5,2,3,3,5,2,11,2,
+  11,2,9,3,8,3,11,3,0,1,11,3,11,2,11,2,
+  3,2,6,2,3,3,5,2,4,2,4,3,4,3,0,3,
+  0,2,7,3,0,1,15,0,15,0,15,0,15,0,15,0,
+  8,0,52,95,13,30,0,250,13,15,0,15,0,15,0,15,
+  0,15,0,15,0,8,3,10,3,9,3,0,1,8,2,1,
+  2,8,2,1,2,7,2,2,2,6,3,2,2,6,2,3,
+  2,5,2,4,2,5,2,4,2,4,2,5,2,4,3,0,
+  3,0,3,0,2,2,3,0,3,0,3,0,2,9,2,11,
+  2,11,2,11,2,15,0,15,0,15,0,15,0,15,0,6,
+  0,53,91,13,30,0,250,13,15,0,15,0,15,0,15,0,
+  15,0,15,0,3,3,0,3,0,2,5,2,11,2,11,2,
+  11,2,11,2,1,3,0,1,6,3,0,3,0,2,5,2,
+  4,2,5,1,6,2,11,2,11,2,11,2,11,2,3,2,
+  6,2,3,3,4,2,5,3,0,3,0,1,8,3,0,1,
+  15,0,15,0,15,0,15,0,15,0,8,0,54,105,13,30,
+  0,250,13,15,0,15,0,15,0,15,0,15,0,15,0,5,
+  3,0,2,7,3,1,3,5,2,5,2,3,3,5,2,3,
+  2,11,2,11,2,2,3,0,1,5,2,1,3,0,3,0,
+  1,3,3,0,1,3,3,3,3,5,3,2,2,7,2,2,
+  2,7,2,2,2,7,2,2,2,7,2,3,2,5,2,5,
+  3,1,3,0,1,6,3,0,2,15,0,15,0,15,0,15,
+  0,15,0,7,0,55,71,13,30,0,250,13,15,0,15,0,
+  15,0,15,0,15,0,15,0,2,3,0,3,0,3,0,1,
+  11,2,11,2,10,2,11,2,10,3,10,2,11,2,10,3,
+  10,2,11,2,10,3,10,2,11,2,10,3,10,2,10,3,
+  15,0,15,0,15,0,15,0,15,0,10,0,56,103,13,30,
+  0,250,13,15,0,15,0,15,0,15,0,15,0,15,0,5,
+  3,0,2,7,3,1,3,5,2,5,2,4,2,5,2,4,
+  2,5,2,4,2,5,2,5,2,3,2,7,3,0,2,7,
+  3,1,3,5,2,5,2,3,2,7,2,2,2,7,2,2,
+  2,7,2,2,2,7,2,3,2,5,3,3,3,0,1,1,
+  3,0,1,6,3,0,2,15,0,15,0,15,0,15,0,15,
+  0,7,0,57,101,13,30,0,250,13,15,0,15,0,15,0,
+  15,0,15,0,15,0,5,3,0,2,6,3,0,3,0,3,
+  4,2,5,2,3,2,6,3,2,2,7,2,2,2,7,2,
+  2,2,6,3,2,3,5,3,3,3,3,3,0,1,4,3,
+  0,3,1,2,11,2,11,2,10,3,3,2,5,2,4,2,
+  4,3,4,3,0,3,0,2,7,3,0,2,15,0,15,0,
+  15,0,15,0,15,0,7,0,0,0
+};
+/*
+  Fontname: ucg_font_fur11_hf
+  Glyphs: 2/189
+  BBX Build Mode: 1
+*/
+const ucg_fntpgm_uint8_t ucg_font_fur11_hf[73] UCG_FONT_SECTION("ucg_font_fur11_hf") = {
+  2,1,4,2,4,5,1,3,5,15,20,255,252,11,253,11,
+  253,0,0,0,0,109,25,77,163,63,63,72,76,54,146,137,
+  36,84,18,42,9,149,132,74,66,37,161,122,134,0,112,25,
+  73,35,63,215,137,65,198,36,36,73,69,82,145,144,68,35,
+  73,12,50,193,122,4,0,0,0
+};
@@ -0,0 +1,839 @@
+/*!
+ *  \file    bench.c
+ *  \brief   Host rendering benchmark for ucglib
+ *
+ *  Every test draws a scene on a 160 x 128 screen (ucg_SetRotate90(), like
+ *  the clock) in two ways:
+ *
+ *  - with the framebuffer device ucg_dev_host_fb(). This measures the pixel per
+ *    second of the library on the host and counts the pixel of the scene.
+ *  - with the ST7735 driver and the counting communication callback ucg_com_host().
+ *    This counts the bytes, commands and CS/CD changes that are sent to the display.
+ *    The SPI time is estimated for a SPI clock of BENCH_SPI_HZ.
+ *
+ *  The image of the emulated ST7735 is written to <test>.ppm. Both images must
+ *  be equal: the number of different pixel is reported and the exit status is 1
+ *  if a test has a difference.
+ *
+ *  The second table shows the CPU time of the position preamble of a line
+ *  (ucg_com_SendCmdSeq() of a set_pos sequence) with the interpreted command
+ *  sequence and with the native emitter of the driver (ucg->cmd_seq_fast). The
+ *  communication callback does nothing, only the time of ucglib is measured.
+ *  Both must send the same bytes.
+ *
+ *  The third table shows the triangles per second of a clock hand on the ST7735:
+ *  the CPU time of ucglib (the communication callback does nothing) and the limit
+ *  of the SPI.
+ *
+ *  The fourth table compares the redraw of the clock for a new minute, averaged over
+ *  all minutes of a day: the changed glyphs of ucg_font_fur35_hf (like ucg_PrintSlot()
+ *  of textslot.c) and the changed segments of the seven segment clock (segdigit.c).
+ *
+ *  The fifth table checks the text slots (textslot.c): a value of variable width with
+ *  a unit behind it and a string in a font with glyphs of different heights
+ *  (ucg_font_helvB18_tr) are printed in slots for a list of strings that grow, shrink,
+ *  change their width, change short glyphs into high glyphs and back, and change
+ *  their color. After each step the emulated ST7735 must be equal to a complete
+ *  redraw of the strings on a cleared framebuffer.
+ *
+ *  The sixth table compares the rotation of the ST7735 with the memory access
+ *  control (ucg_SetHwRotate()) with the rotation callbacks of ucglib (ucg_SetRotate90()
+ *  etc.). All scenes are drawn for 90, 180 and 270 degree, the framebuffer device
+ *  is the reference for both. The bytes of all scenes are reported, the images
+ *  must be equal.
+ *
+ *  The seventh table draws all scenes through the strip device (ucg_strip.c) with
+ *  BENCH_STRIP_LINES lines onto the ST7735. Every strip is a complete window, the
+ *  framebuffer device on a black screen is the reference. The bytes of the scene
+ *  without the strip, the bytes and CS changes of one frame with the strip and the
+ *  number of strips are reported, the images must be equal.
+ *
+ *  The eighth table draws bitmap lines in all directions on the ILI9341
+ *  (ucg_dev_ili9341_18x240x320), not rotated and rotated by ucg_SetRotate90(). The
+ *  emulated panel is 240 x 320 for this test (ucg_host_SetPanel()).
+ *
+ *  Build and run on the host (from the Wekker/host directory):
+ *
+ *      make run
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "ucg_host.h"
+#include "segdigit.h"
+#include "textslot.h"
+
+#define BENCH_MIN_TIME   0.2          //!< minimum time for the pixel per second measurement
+#define BENCH_SPI_HZ     8000000.0    //!< SPI clock of the Xmega: 32 MHz / 4
+#define BENCH_STRIP_LINES 16          //!< lines of a strip of the strip device (ucg_strip.c)
+
+/*!
+ * A test of the benchmark
+ */
+typedef struct {
+  const char *name;             //!< name of the test and the PPM file
+  void (*draw)(ucg_t *ucg);     //!< draws the scene
+} bench_t;
+
+static double now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void draw_font_solid(ucg_t *ucg)
+{
+  ucg_SetFontMode(ucg, UCG_FONT_MODE_SOLID);
+  ucg_SetColor(ucg, 0, 255, 50, 50);
+  ucg_SetColor(ucg, 1, 0, 0, 0);
+  ucg_SetFont(ucg, ucg_font_fur35_hf);
+  ucg_DrawString(ucg, 7, 48, 0, "12 : 34");
+  ucg_SetColor(ucg, 0, 255, 255, 10);
+  ucg_SetFont(ucg, ucg_font_fur17_hf);
+  ucg_DrawString(ucg, 10, 100, 0, "050%");
+  ucg_DrawString(ucg, 75, 100, 0, "0500");
+  ucg_SetFont(ucg, ucg_font_fur11_hf);
+  ucg_DrawString(ucg, 127, 100, 0, "ppm");
+}
+
+static void draw_font_transparent(ucg_t *ucg)
+{
+  ucg_SetFontMode(ucg, UCG_FONT_MODE_TRANSPARENT);
+  ucg_SetColor(ucg, 0, 50, 255, 50);
+  ucg_SetFont(ucg, ucg_font_fur17_hf);
+  ucg_DrawString(ucg, 5, 30, 0, "Wekker 07:45");
+  ucg_DrawString(ucg, 150, 40, 1, "dir 1");
+  ucg_SetFont(ucg, ucg_font_fur11_hf);
+  ucg_DrawString(ucg, 5, 60, 0, "The quick brown fox");
+  ucg_DrawString(ucg, 5, 80, 0, "jumps over the lazy");
+  ucg_DrawString(ucg, 155, 120, 2, "dog 0123456789");
+}
+
+static void draw_box(ucg_t *ucg)
+{
+  ucg_int_t i;
+
+  ucg_SetColor(ucg, 0, 20, 80, 200);
+  ucg_DrawBox(ucg, 0, 0, 160, 128);
+  for (i = 0; i < 8; i++) {
+    ucg_SetColor(ucg, 0, 30 * i, 255 - 30 * i, 128);
+    ucg_DrawBox(ucg, 4 + 9 * i, 4 + 7 * i, 60, 40);
+  }
+  ucg_SetColor(ucg, 0, 255, 255, 255);
+  ucg_DrawFrame(ucg, 100, 70, 50, 50);
+  ucg_DrawRBox(ucg, 104, 74, 42, 42, 8);
+}
+
+static void draw_line(ucg_t *ucg)
+{
+  ucg_int_t i;
+
+  ucg_SetColor(ucg, 0, 255, 255, 0);
+  for (i = 0; i < 160; i += 10) {
+    ucg_DrawLine(ucg, 80, 64, i, 0);
+    ucg_DrawLine(ucg, 80, 64, 159 - i, 127);
+  }
+  for (i = 0; i < 128; i += 10) {
+    ucg_DrawLine(ucg, 80, 64, 0, 127 - i);
+    ucg_DrawLine(ucg, 80, 64, 159, i);
+  }
+  ucg_SetColor(ucg, 0, 0, 255, 255);
+  ucg_DrawHLine(ucg, 0, 2, 160);
+  ucg_DrawVLine(ucg, 2, 0, 128);
+  ucg_DrawLine(ucg, -20, 140, 180, -10);      // clipped
+}
+
+// humidity history, one sample every 2.5 pixel
+static const unsigned char graph_data[64] = {
+  40, 42, 45, 47, 46, 44, 43, 43, 45, 50, 56, 60, 61, 60, 58, 55,
+  52, 50, 49, 49, 50, 52, 55, 59, 64, 70, 75, 78, 79, 77, 73, 68,
+  62, 57, 53, 50, 48, 47, 47, 48, 50, 53, 57, 60, 62, 63, 62, 60,
+  57, 54, 52, 51, 51, 52, 54, 57, 61, 66, 72, 79, 85, 90, 93, 95,
+};
+
+static void draw_graph(ucg_t *ucg)
+{
+  ucg_int_t i, x0, y0, x1, y1;
+
+  ucg_SetColor(ucg, 0, 80, 80, 80);
+  ucg_DrawHLine(ucg, 0, 127, 160);
+  ucg_DrawVLine(ucg, 0, 0, 128);
+  ucg_SetColor(ucg, 0, 0, 200, 255);
+  for (i = 1; i < 64; i++) {
+    x0 = (i - 1) * 5 / 2;
+    x1 = i * 5 / 2;
+    y0 = 127 - graph_data[i - 1];
+    y1 = 127 - graph_data[i];
+    ucg_DrawLine(ucg, x0, y0, x1, y1);
+    ucg_DrawLine(ucg, x0, y0 / 2, x1, y1 / 2);
+  }
+  ucg_DrawLine(ucg, -100, 500, 300, -400);        // clipped
+  ucg_DrawLine(ucg, 200, 10, 400, 100);           // outside
+}
+
+static void draw_disc(ucg_t *ucg)
+{
+  ucg_SetColor(ucg, 0, 255, 0, 0);
+  ucg_DrawDisc(ucg, 40, 40, 30, UCG_DRAW_ALL);
+  ucg_SetColor(ucg, 0, 0, 255, 0);
+  ucg_DrawDisc(ucg, 110, 60, 45, UCG_DRAW_ALL);
+  ucg_SetColor(ucg, 0, 0, 0, 255);
+  ucg_DrawDisc(ucg, 150, 120, 20, UCG_DRAW_ALL);  // clipped
+  ucg_SetColor(ucg, 0, 255, 255, 255);
+  ucg_DrawCircle(ucg, 40, 100, 20, UCG_DRAW_ALL);
+  ucg_DrawCircle(ucg, 80, 64, 60, UCG_DRAW_ALL);
+}
+
+// rounded panels of a dashboard, redrawn every second
+static void draw_panel(ucg_t *ucg)
+{
+  ucg_SetColor(ucg, 0, 30, 30, 60);
+  ucg_DrawRBox(ucg, 2, 2, 156, 60, 10);
+  ucg_SetColor(ucg, 0, 60, 30, 30);
+  ucg_DrawRBox(ucg, 2, 66, 76, 60, 8);
+  ucg_SetColor(ucg, 0, 30, 60, 30);
+  ucg_DrawRBox(ucg, 82, 66, 76, 60, 8);
+  ucg_SetColor(ucg, 0, 255, 200, 0);
+  ucg_DrawDisc(ucg, 20, 20, 6, UCG_DRAW_ALL);
+  ucg_DrawRBox(ucg, 140, 110, 40, 40, 12);         // clipped
+}
+
+// info of the clock: values and units over a panel, like print_info() of main.c
+static void draw_info(ucg_t *ucg)
+{
+  ucg_int_t w;
+
+  ucg_SetColor(ucg, 0, 30, 30, 60);
+  ucg_DrawRBox(ucg, 4, 76, 152, 48, 8);
+  ucg_SetFontMode(ucg, UCG_FONT_MODE_TRANSPARENT);
+  ucg_SetColor(ucg, 0, 255, 255, 10);
+  ucg_SetFont(ucg, ucg_font_fur17_hf);
+  ucg_DrawString(ucg, 10, 100, 0, "045%");
+  w = ucg_DrawString(ucg, 75, 100, 0, "0812");
+  ucg_SetFont(ucg, ucg_font_fur11_hf);
+  ucg_DrawString(ucg, 75 + w, 100, 0, "ppm");
+  ucg_SetFontMode(ucg, UCG_FONT_MODE_SOLID);
+  ucg_SetColor(ucg, 1, 30, 30, 60);
+  ucg_DrawString(ucg, 10, 118, 0, "CO2");
+  ucg_DrawString(ucg, 75, 118, 0, "Alarm 07:30");
+}
+
+// seven segment clock: two sizes, a few minutes with a blinking colon
+static void draw_segclock(ucg_t *ucg)
+{
+  ucg_seg_clock_t big, small;
+  int i;
+
+  ucg_SetColor(ucg, 0, 255, 50, 50);
+  ucg_SetColor(ucg, 1, 0, 0, 0);
+  ucg_InitSegClock(&big, 19, 12, 24, 36, 5, 0);
+  ucg_InitSegClock(&small, 10, 70, 16, 28, 4, 1);
+  for (i = 0; i < 4; i++) {
+    ucg_PrintSegClock(ucg, &big, 12, 58 + i, i & 1);
+    ucg_PrintSegClock(ucg, &small, 7, 45 + i, 1);
+  }
+  ucg_SetColor(ucg, 0, 50, 255, 50);
+  ucg_PrintSegClock(ucg, &small, 8, 0, 1);        // new color: all segments
+}
+
+static void draw_polygon(ucg_t *ucg)
+{
+  ucg_int_t i;
+
+  for (i = 0; i < 6; i++) {
+    ucg_SetColor(ucg, 0, 40 * i, 100, 255 - 40 * i);
+    ucg_DrawTriangle(ucg, 10 + 25 * i, 10, 30 + 25 * i, 60, 0 + 25 * i, 50);
+  }
+  ucg_SetColor(ucg, 0, 255, 128, 0);
+  ucg_DrawTetragon(ucg, 20, 70, 140, 75, 120, 125, 10, 110);
+  ucg_SetColor(ucg, 0, 128, 0, 255);
+  ucg_DrawTriangle(ucg, -30, 100, 80, 140, 200, 90);   // clipped
+}
+
+// sin(i * 30 degree) * 64
+static const signed char needle_sin[12] = { 0, 32, 55, 64, 55, 32, 0, -32, -55, -64, -55, -32 };
+
+/*! \brief  Draws a clock hand from the center (80, 64) as triangle
+ *  \param  ucg     the device
+ *  \param  i       position 0..11 (hour)
+ *  \param  len     length in 1/64 pixel
+ */
+static void draw_needle(ucg_t *ucg, ucg_int_t i, ucg_int_t len)
+{
+  ucg_int_t s = needle_sin[i % 12];
+  ucg_int_t c = needle_sin[(i + 3) % 12];
+  ucg_int_t x = 80 + s * len / 4096;
+  ucg_int_t y = 64 - c * len / 4096;
+
+  // base of 8 pixel, perpendicular to the hand
+  ucg_DrawTriangle(ucg, 80 - c / 16, 64 - s / 16, 80 + c / 16, 64 + s / 16, x, y);
+}
+
+static void draw_needles(ucg_t *ucg)
+{
+  ucg_int_t i;
+
+  for (i = 0; i < 12; i++) {
+    ucg_SetColor(ucg, 0, 20 * i, 255 - 20 * i, 100);
+    draw_needle(ucg, i, 60 * 64 - 200 * i);
+  }
+  ucg_SetColor(ucg, 0, 255, 255, 255);
+  ucg_DrawTetragon(ucg, 78, 64, 82, 64, 82, 4, 78, 4);           // vertical bar
+  ucg_DrawTetragon(ucg, 70, 110, 90, 110, 95, 125, 65, 125);     // trapezoid
+}
+
+static void draw_gradient(ucg_t *ucg)
+{
+  ucg_SetColor(ucg, 0, 255, 0, 0);
+  ucg_SetColor(ucg, 1, 0, 255, 0);
+  ucg_SetColor(ucg, 2, 255, 0, 255);
+  ucg_SetColor(ucg, 3, 0, 255, 255);
+  ucg_DrawGradientBox(ucg, 0, 0, 160, 100);
+  ucg_SetColor(ucg, 0, 255, 255, 255);
+  ucg_SetColor(ucg, 1, 0, 0, 0);
+  ucg_DrawGradientLine(ucg, 0, 110, 160, 0);
+  ucg_DrawGradientLine(ucg, 150, 100, 28, 1);
+}
+
+// 16 x 16 icon, one bit per pixel
+static const unsigned char icon[32] = {
+  0x07, 0xe0, 0x18, 0x18, 0x20, 0x04, 0x40, 0x02, 0x4c, 0x32, 0x8c, 0x31, 0x80, 0x01, 0x80, 0x01,
+  0x80, 0x01, 0x90, 0x09, 0x48, 0x12, 0x47, 0xe2, 0x20, 0x04, 0x18, 0x18, 0x07, 0xe0, 0x00, 0x00
+};
+
+static void draw_icon(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t dir, uint8_t transparent)
+{
+  ucg_int_t i;
+
+  for (i = 0; i < 16; i++) {
+    switch (dir) {
+      case 0: y++; break;
+      case 1: x--; break;
+      case 2: y--; break;
+      default: x++; break;
+    }
+    if (transparent) {
+      ucg_DrawTransparentBitmapLine(ucg, x, y, dir, 16, icon + 2 * i);
+    } else {
+      ucg_DrawBitmapLine(ucg, x, y, dir, 16, icon + 2 * i);
+    }
+  }
+}
+
+static void draw_bitmap(ucg_t *ucg)
+{
+  ucg_int_t i;
+
+  ucg_SetColor(ucg, 0, 255, 255, 0);
+  ucg_SetColor(ucg, 1, 0, 0, 128);
+  for (i = 0; i < 8; i++) {
+    draw_icon(ucg, 4 + 19 * i, 2, 0, 0);
+    draw_icon(ucg, 4 + 19 * i, 40, 0, 1);
+  }
+  draw_icon(ucg, 40, 70, 1, 0);
+  draw_icon(ucg, 80, 100, 2, 1);
+  draw_icon(ucg, 100, 80, 3, 0);
+  draw_icon(ucg, 150, 110, 0, 1);                // clipped
+  draw_icon(ucg, -8, 100, 0, 0);                 // clipped
+}
+
+// bitmap lines in all directions on the 240 x 320 ILI9341, clipped at all edges
+static void draw_bitmap_ili9341(ucg_t *ucg)
+{
+  ucg_int_t i, w = ucg_GetWidth(ucg), h = ucg_GetHeight(ucg);
+
+  // only 0 and 255: the ILI9341 shows 18 bit, the framebuffer device stores RGB565
+  ucg_SetColor(ucg, 0, 255, 255, 0);
+  ucg_SetColor(ucg, 1, 0, 0, 255);
+  for (i = 0; i < 4; i++) {
+    draw_icon(ucg, 20 + 40 * i, 20, i, 0);
+    draw_icon(ucg, 20 + 40 * i, 60, i, 1);
+  }
+  ucg_SetColor(ucg, 0, 255, 0, 255);
+  ucg_SetColor(ucg, 1, 0, 255, 0);
+  for (i = 0; i < 4; i++) {
+    draw_icon(ucg, w - 8, 100 + 30 * i, i, i & 1);     // clipped right
+    draw_icon(ucg, -8, 100 + 30 * i, i, i & 1);        // clipped left
+    draw_icon(ucg, 40 + 30 * i, h - 6, i, i & 1);      // clipped bottom
+    draw_icon(ucg, 40 + 30 * i, -6, i, i & 1);         // clipped top
+  }
+}
+
+static const bench_t bench[] = {
+  { "font_solid",       draw_font_solid },
+  { "font_transparent", draw_font_transparent },
+  { "box",              draw_box },
+  { "line",             draw_line },
+  { "graph",            draw_graph },
+  { "disc",             draw_disc },
+  { "panel",            draw_panel },
+  { "info",             draw_info },
+  { "segclock",         draw_segclock },
+  { "polygon",          draw_polygon },
+  { "needles",          draw_needles },
+  { "gradient",         draw_gradient },
+  { "bitmap",           draw_bitmap },
+};
+
+/*! \brief  Communication callback that does nothing
+ */
+static int16_t com_null(ucg_t *ucg, int16_t msg, uint16_t arg, uint8_t *data)
+{
+  return 1;
+}
+
+/*! \brief  Measures the time of a line with one pixel, which is mostly the preamble
+ *  \param  dir      direction of the line
+ *  \param  fast     0: interpret the command sequences
+ *  \return nanoseconds per line
+ */
+static double preamble_ns(ucg_int_t dir, int fast)
+{
+  ucg_t  ucg;
+  long   i, n = 0;
+  double t;
+
+  memset(&ucg, 0, sizeof(ucg));
+  ucg_Init(&ucg, ucg_dev_st7735_18x128x160, ucg_ext_st7735_18, com_null);
+  if (!fast) ucg.cmd_seq_fast = NULL;
+  ucg_SetColor(&ucg, 0, 255, 255, 255);
+
+  t = now();
+  do {
+    for (i = 0; i < 1000; i++) {
+      ucg_Draw90Line(&ucg, 64, 80, 1, dir, 0);
+    }
+    n += 1000;
+  } while (now() - t < BENCH_MIN_TIME);
+
+  return (now() - t) / n * 1e9;
+}
+
+/*! \brief  Records the bytes of the line scene
+ *  \param  trace    buffer
+ *  \param  size     number of entries of the buffer
+ *  \param  fast     0: interpret the command sequences
+ *  \return number of bytes
+ */
+static long preamble_trace(ucg_host_trace_t *trace, long size, int fast)
+{
+  ucg_t ucg;
+
+  memset(&ucg, 0, sizeof(ucg));
+  ucg_Init(&ucg, ucg_dev_st7735_18x128x160, ucg_ext_st7735_18, ucg_com_host);
+  if (!fast) ucg.cmd_seq_fast = NULL;
+  ucg_SetRotate90(&ucg);
+  ucg_host_StartTrace(trace, size);
+  draw_line(&ucg);
+  return ucg_host_StopTrace();
+}
+
+/*! \brief  Compares the preamble of the interpreted and the native command sequences
+ *  \return 1 if the native emitters send other bytes
+ */
+static int bench_preamble(void)
+{
+  static ucg_host_trace_t t0[100000], t1[100000];
+  ucg_int_t dir;
+  double    ns0, ns1;
+  long      n0, n1;
+
+  printf("\n%-17s %10s %10s %7s\n", "preamble", "seq ns", "native ns", "speedup");
+  for (dir = 0; dir < 4; dir++) {
+    ns0 = preamble_ns(dir, 0);
+    ns1 = preamble_ns(dir, 1);
+    printf("line dir %d        %10.1f %10.1f %7.2f\n", dir, ns0, ns1, ns0 / ns1);
+  }
+
+  n0 = preamble_trace(t0, 100000, 0);
+  n1 = preamble_trace(t1, 100000, 1);
+  if (n0 != n1 || memcmp(t0, t1, n0 * sizeof(t0[0])) != 0) {
+    printf("native emitters send other bytes than the sequences\n");
+    return 1;
+  }
+  printf("same bytes for the line scene: %ld\n", n0);
+
+  return 0;
+}
+
+/*! \brief  Measures the triangles per second of the clock hands on the ST7735
+ *  \return 0
+ */
+static int bench_triangles(void)
+{
+  ucg_t  ucg;
+  long   i, n = 0, bytes;
+  double t;
+
+  memset(&ucg, 0, sizeof(ucg));
+  ucg_Init(&ucg, ucg_dev_st7735_18x128x160, ucg_ext_st7735_18, com_null);
+  ucg_SetRotate90(&ucg);
+  ucg_SetColor(&ucg, 0, 255, 255, 255);
+
+  t = now();
+  do {
+    for (i = 0; i < 1000; i++) {
+      draw_needle(&ucg, i, 50 * 64);
+    }
+    n += 1000;
+  } while (now() - t < BENCH_MIN_TIME);
+  t = now() - t;
+
+  ucg_Init(&ucg, ucg_dev_st7735_18x128x160, ucg_ext_st7735_18, ucg_com_host);
+  ucg_SetRotate90(&ucg);
+  ucg_host_ClearStat();
+  for (i = 0; i < 12; i++) {
+    draw_needle(&ucg, i, 50 * 64);
+  }
+  bytes = ucg_host_stat.bytes;
+
+  printf("\n%-17s %10s %10s %7s %7s\n", "triangles", "cpu tri/s", "spi tri/s", "bytes", "cs");
+  printf("%-17s %10.0f %10.0f %7ld %7ld\n", "clock hand", n / t,
+         12 / (bytes * 8.0 / BENCH_SPI_HZ), bytes / 12, ucg_host_stat.cs / 12);
+
+  return 0;
+}
+
+/*! \brief  Compares the bytes for a new minute: glyphs of ucg_font_fur35_hf and segments
+ *  \return 0
+ */
+static int bench_clock_minute(void)
+{
+  ucg_t   ucg;
+  ucg_seg_clock_t clock;
+  char    old[8], text[8];
+  long    t, glyph = 0, seg = 0, glyph_cmds = 0, seg_cmds = 0;
+  int     i;
+
+  memset(&ucg, 0, sizeof(ucg));
+  ucg_Init(&ucg, ucg_dev_st7735_18x128x160, ucg_ext_st7735_18, ucg_com_host);
+  ucg_SetHwRotate(&ucg, 1);
+  ucg_SetColor(&ucg, 0, 255, 50, 50);
+  ucg_SetColor(&ucg, 1, 0, 0, 0);
+  ucg_SetFontMode(&ucg, UCG_FONT_MODE_SOLID);
+  ucg_SetFont(&ucg, ucg_font_fur35_hf);
+  ucg_InitSegClock(&clock, 19, 12, 24, 36, 5, 0);
+  ucg_PrintSegClock(&ucg, &clock, 23, 59, 1);
+  snprintf(old, sizeof(old), "%.2d : %.2d", 23, 59);
+
+  for (t = 0; t < 24 * 60; t++) {
+    // the digits of fur35 have the same width: a changed glyph is drawn at its old position
+    snprintf(text, sizeof(text), "%.2d : %.2d", (int) (t / 60), (int) (t % 60));
+    ucg_host_ClearStat();
+    for (i = 0; text[i] != '\0'; i++) {
+      if (text[i] != old[i]) {
+        ucg_DrawGlyph(&ucg, 7 + i * ucg_GetGlyphWidth(&ucg, '0'), 48, 0, text[i]);
+      }
+    }
+    glyph += ucg_host_stat.bytes;
+    glyph_cmds += ucg_host_stat.cmds;
+    memcpy(old, text, sizeof(old));
+
+    ucg_host_ClearStat();
+    ucg_PrintSegClock(&ucg, &clock, t / 60, t % 60, 1);
+    seg += ucg_host_stat.bytes;
+    seg_cmds += ucg_host_stat.cmds;
+  }
+
+  printf("\n%-17s %10s %10s %7s\n", "clock minute", "bytes", "cmds", "spi us");
+  printf("%-17s %10.1f %10.1f %7.1f\n", "fur35 glyphs", glyph / 1440.0, glyph_cmds / 1440.0,
+         glyph / 1440.0 * 8.0 / BENCH_SPI_HZ * 1e6);
+  printf("%-17s %10.1f %10.1f %7.1f\n", "segments", seg / 1440.0, seg_cmds / 1440.0,
+         seg / 1440.0 * 8.0 / BENCH_SPI_HZ * 1e6);
+
+  return 0;
+}
+
+/*! \brief  Compares text slots with a complete redraw of the strings on a cleared screen
+ *  \return number of different pixel
+ */
+static long bench_slot(void)
+{
+  static const struct {
+    const char *value;    //!< ucg_font_fur17_hf with "ppm" behind it
+    const char *tight;    //!< ucg_font_helvB18_tr, the glyphs have different heights
+    uint8_t     green;    //!< green of the foreground color
+  } step[] = {
+    { "7",    "888",  255 }, { "42",   "8-8",  255 }, { "1234", "8_8",  255 },
+    { "1235", "-8-",  255 }, { "9",    "8",    255 }, { "",     "",     255 },
+    { "0500", "g8",   255 }, { "1111", "8g",   255 }, { "4444", ".-_",  255 },
+    { "WiWi", "WiWi", 255 }, { "iWiW", "iWiW", 255 }, { "Wi",   "Wi",   255 },
+    { "1000", "1000", 255 }, { "999",  "999",  128 }, { "1200", "8-",   128 },
+    { "80",   "8",    255 }
+  };
+  ucg_t    fb, lcd;
+  ucg_text_slot_t value, unit, tight;
+  ucg_int_t w;
+  long     bytes = 0, diff = 0;
+  unsigned int i;
+
+  memset(&fb, 0, sizeof(fb));
+  memset(&lcd, 0, sizeof(lcd));
+  ucg_Init(&fb, ucg_dev_host_fb, ucg_ext_none, (ucg_com_fnptr) 0);
+  ucg_SetRotate90(&fb);
+  ucg_Init(&lcd, ucg_dev_st7735_18x128x160, ucg_ext_st7735_18, ucg_com_host);
+  ucg_SetRotate90(&lcd);
+  ucg_SetFontMode(&fb, UCG_FONT_MODE_SOLID);
+  ucg_SetFontMode(&lcd, UCG_FONT_MODE_SOLID);
+  ucg_SetColor(&fb, 1, 0, 0, 80);
+  ucg_SetColor(&lcd, 1, 0, 0, 80);
+
+  ucg_host_ClearBuffers();
+  ucg_SetColor(&lcd, 0, 0, 0, 80);
+  ucg_DrawBox(&lcd, 0, 0, 160, 128);
+  ucg_InitTextSlot(&value, 40, 100);
+  ucg_InitTextSlot(&unit, 40, 100);
+  ucg_InitTextSlot(&tight, 20, 50);
+
+  for (i = 0; i < sizeof(step) / sizeof(step[0]); i++) {
+    ucg_SetColor(&fb, 0, 0, 0, 80);
+    ucg_DrawBox(&fb, 0, 0, 160, 128);
+    ucg_SetColor(&fb, 0, 255, step[i].green, 10);
+    ucg_SetFont(&fb, ucg_font_fur17_hf);
+    w = ucg_DrawString(&fb, 40, 100, 0, step[i].value);
+    ucg_SetFont(&fb, ucg_font_fur11_hf);
+    ucg_DrawString(&fb, 40 + w, 100, 0, "ppm");
+    ucg_SetFont(&fb, ucg_font_helvB18_tr);
+    ucg_DrawString(&fb, 20, 50, 0, step[i].tight);
+
+    ucg_host_ClearStat();
+    ucg_SetColor(&lcd, 0, 255, step[i].green, 10);
+    ucg_SetFont(&lcd, ucg_font_fur17_hf);
+    w = ucg_PrintSlot(&lcd, &value, "%s", step[i].value);
+    ucg_SetFont(&lcd, ucg_font_fur11_hf);
+    ucg_MoveTextSlot(&lcd, &unit, 40 + w, 100);
+    ucg_PrintSlot(&lcd, &unit, "ppm");
+    ucg_SetFont(&lcd, ucg_font_helvB18_tr);
+    ucg_PrintSlot(&lcd, &tight, "%s", step[i].tight);
+    bytes += ucg_host_stat.bytes;
+    diff += ucg_host_Diff();
+  }
+
+  printf("\n%-17s %10s %10s %7s\n", "text slot", "strings", "bytes", "diff");
+  printf("%-17s %10u %10ld %7ld\n", "slots", i, bytes, diff);
+
+  return diff;
+}
+
+/*! \brief  Rotates a device with the rotation callbacks of ucglib
+ *  \param  ucg       the device
+ *  \param  rotation  1..3: 90, 180, 270 degree
+ */
+static void set_rotate(ucg_t *ucg, uint8_t rotation)
+{
+  switch (rotation) {
+    case 1:  ucg_SetRotate90(ucg); break;
+    case 2:  ucg_SetRotate180(ucg); break;
+    default: ucg_SetRotate270(ucg); break;
+  }
+}
+
+/*! \brief  Draws all scenes with the rotation callbacks and with the rotation of the ST7735
+ *  \return number of different pixel
+ */
+static long bench_hw_rotate(void)
+{
+  ucg_t    fb, sw, hw;
+  uint8_t  rotation;
+  unsigned int i;
+  long     bytes_sw, bytes_hw, diff_sw, diff_hw, diff = 0;
+
+  printf("\n%-17s %10s %10s %7s %7s\n", "rotation", "sw bytes", "hw bytes", "sw diff", "hw diff");
+  for (rotation = 1; rotation < 4; rotation++) {
+    memset(&fb, 0, sizeof(fb));
+    memset(&sw, 0, sizeof(sw));
+    memset(&hw, 0, sizeof(hw));
+    ucg_Init(&fb, ucg_dev_host_fb, ucg_ext_none, (ucg_com_fnptr) 0);
+    ucg_SetHwRotate(&fb, rotation);                // not supported: rotation callbacks
+    ucg_Init(&sw, ucg_dev_st7735_18x128x160, ucg_ext_st7735_18, ucg_com_host);
+    set_rotate(&sw, rotation);
+    ucg_Init(&hw, ucg_dev_st7735_18x128x160, ucg_ext_st7735_18, ucg_com_host);
+    ucg_SetHwRotate(&hw, rotation);
+
+    bytes_sw = bytes_hw = diff_sw = diff_hw = 0;
+    for (i = 0; i < sizeof(bench) / sizeof(bench[0]); i++) {
+      ucg_host_ClearBuffers();
+      bench[i].draw(&fb);
+
+      ucg_host_ClearStat();
+      bench[i].draw(&sw);
+      bytes_sw += ucg_host_stat.bytes;
+      diff_sw += ucg_host_Diff();
+
+      // sw and hw share the emulated ST7735, sw has changed the memory access control
+      ucg_SetHwRotate(&hw, rotation);
+      memset(ucg_host_lcd, 0, sizeof(ucg_host_lcd));
+      ucg_host_ClearStat();
+      bench[i].draw(&hw);
+      bytes_hw += ucg_host_stat.bytes;
+      diff_hw += ucg_host_Diff();
+    }
+    printf("%3d degree        %10ld %10ld %7ld %7ld\n",
+           rotation * 90, bytes_sw, bytes_hw, diff_sw, diff_hw);
+    diff += diff_sw + diff_hw;
+  }
+
+  return diff;
+}
+
+/*! \brief  Draws all scenes through the strip device onto the ST7735
+ *  \return number of different pixel
+ */
+static long bench_strip(void)
+{
+  static uint16_t buf[160 * BENCH_STRIP_LINES];
+  ucg_t    fb, lcd;
+  ucg_strip_t strip;
+  unsigned int i;
+  long     direct, diff, total = 0;
+
+  printf("\n%-17s %10s %10s %6s %6s %7s\n", "strip", "direct", "bytes", "cs", "strips", "diff");
+  for (i = 0; i < sizeof(bench) / sizeof(bench[0]); i++) {
+    int strips = 0;
+
+    memset(&fb, 0, sizeof(fb));
+    memset(&lcd, 0, sizeof(lcd));
+    ucg_Init(&fb, ucg_dev_host_fb, ucg_ext_none, (ucg_com_fnptr) 0);
+    ucg_SetRotate90(&fb);
+    ucg_Init(&lcd, ucg_dev_st7735_18x128x160, ucg_ext_st7735_18, ucg_com_host);
+    ucg_SetRotate90(&lcd);
+
+    // bytes of the scene without the strip, drawn on a black display
+    ucg_host_ClearBuffers();
+    ucg_host_ClearStat();
+    bench[i].draw(&lcd);
+    direct = ucg_host_stat.bytes;
+
+    // the reference is the framebuffer device, the strip also sends the black pixel
+    ucg_host_ClearBuffers();
+    bench[i].draw(&fb);
+    memset(ucg_host_lcd, 0xff, sizeof(ucg_host_lcd));
+    ucg_SetStrip(&lcd, &strip, buf, BENCH_STRIP_LINES);
+    ucg_host_ClearStat();
+    ucg_FirstStrip(&lcd);
+    do {
+      bench[i].draw(&lcd);
+      strips++;
+    } while (ucg_NextStrip(&lcd));
+    ucg_UndoStrip(&lcd);
+    diff = ucg_host_Diff();
+
+    printf("%-17s %10ld %10ld %6ld %6d %7ld\n",
+           bench[i].name, direct, ucg_host_stat.bytes, ucg_host_stat.cs, strips, diff);
+    total += diff;
+  }
+
+  return total;
+}
+
+/*! \brief  Draws bitmap lines on the ILI9341, not rotated and with ucg_SetRotate90()
+ *  \return number of different pixel
+ */
+static long bench_ili9341(void)
+{
+  ucg_t    fb, lcd;
+  uint8_t  rotation;
+  long     diff, total = 0;
+
+  ucg_host_SetPanel(240, 320);
+  printf("\n%-17s %10s %7s\n", "ili9341", "bytes", "diff");
+  for (rotation = 0; rotation < 2; rotation++) {
+    memset(&fb, 0, sizeof(fb));
+    memset(&lcd, 0, sizeof(lcd));
+    ucg_Init(&fb, ucg_dev_host_fb, ucg_ext_none, (ucg_com_fnptr) 0);
+    ucg_Init(&lcd, ucg_dev_ili9341_18x240x320, ucg_ext_ili9341_18, ucg_com_host);
+    if (rotation) {
+      ucg_SetRotate90(&fb);
+      ucg_SetRotate90(&lcd);
+    }
+
+    ucg_host_ClearBuffers();
+    draw_bitmap_ili9341(&fb);
+    ucg_host_ClearStat();
+    draw_bitmap_ili9341(&lcd);
+    diff = ucg_host_Diff();
+    if (ucg_host_WritePPM(rotation ? "ili9341_90.ppm" : "ili9341.ppm", ucg_host_lcd) != 0) {
+      printf("could not write the ILI9341 image\n");
+    }
+
+    printf("bitmap %3d degree %10ld %7ld\n", rotation * 90, ucg_host_stat.bytes, diff);
+    total += diff;
+  }
+  ucg_host_SetPanel(UCG_HOST_WIDTH, UCG_HOST_HEIGHT);
+
+  return total;
+}
+
+/*! \brief  Runs one test
+ *  \param  b     the test
+ *  \return number of different pixel between the framebuffer device and the ST7735
+ */
+static long bench_run(const bench_t *b)
+{
+  ucg_t  fb, lcd;
+  char   name[64];
+  long   pixels, rounds = 0;
+  double t;
+  long   diff;
+
+  memset(&fb, 0, sizeof(fb));
+  memset(&lcd, 0, sizeof(lcd));
+  ucg_Init(&fb, ucg_dev_host_fb, ucg_ext_none, (ucg_com_fnptr) 0);
+  ucg_SetRotate90(&fb);
+  ucg_Init(&lcd, ucg_dev_st7735_18x128x160, ucg_ext_st7735_18, ucg_com_host);
+  ucg_SetRotate90(&lcd);
+
+  // pixel per second with the framebuffer device
+  ucg_host_ClearStat();
+  t = now();
+  do {
+    b->draw(&fb);
+    rounds++;
+  } while (now() - t < BENCH_MIN_TIME);
+  t = now() - t;
+  pixels = ucg_host_stat.pixels / rounds;
+
+  // one round on both devices for the communication counters and the images
+  ucg_host_ClearBuffers();
+  b->draw(&fb);
+  ucg_host_ClearStat();
+  b->draw(&lcd);
+  diff = ucg_host_Diff();
+
+  snprintf(name, sizeof(name), "%s.ppm", b->name);
+  if (ucg_host_WritePPM(name, ucg_host_lcd) != 0) {
+    printf("could not write %s\n", name);
+  }
+
+  printf("%-17s %7ld %9.2f %8ld %7.2f %6ld %6ld %6ld %8.2f %5ld\n",
+         b->name, pixels, pixels * rounds / t / 1e6,
+         ucg_host_stat.bytes, pixels ? (double) ucg_host_stat.bytes / pixels : 0.0,
+         ucg_host_stat.cmds, ucg_host_stat.cs, ucg_host_stat.cd,
+         ucg_host_stat.bytes * 8.0 / BENCH_SPI_HZ * 1e3, diff);
+
+  return diff;
+}
+
+int main(void)
+{
+  unsigned int i;
+  long diff = 0;
+
+  printf("%-17s %7s %9s %8s %7s %6s %6s %6s %8s %5s\n",
+         "test", "pixel", "Mpixel/s", "bytes", "b/pixel", "cmds", "cs", "cd", "spi ms", "diff");
+  for (i = 0; i < sizeof(bench) / sizeof(bench[0]); i++) {
+    diff += bench_run(&bench[i]);
+  }
+  diff += bench_preamble();
+  diff += bench_triangles();
+  diff += bench_clock_minute();
+  diff += bench_slot();
+  diff += bench_hw_rotate();
+  diff += bench_strip();
+  diff += bench_ili9341();
+
+  return diff != 0;
+}
@@ -0,0 +1,150 @@
+/*!
+ *  \file    bench_font.c
+ *  \brief   Host benchmark for the ucglib glyph lookup
+ *
+ *  Measures the number of glyph lookups per second for ucg_font_fur35_hf,
+ *  once with the linear glyph search and once with the glyph index
+ *  (ucg_SetFontGlyphIndex()). No display is needed, the lookups only
+ *  read the font data.
+ *
+ *  With the glyph cache enabled (UCG_FONT_CACHE_ENTRIES > 0) the glyphs per
+ *  second for a solid "12 : 34" are measured with a cold and a warm cache,
+ *  the glyphs are sent to a device which accepts and ignores all messages.
+ *
+ *  Build and run on the host (from the Wekker/host directory):
+ *
+ *      make bench_font
+ *      ./bench_font
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "ucg.h"
+
+#define BENCH_ROUNDS  20000
+
+const uint8_t *ucg_font_get_glyph_data(ucg_t *ucg, uint8_t encoding);
+
+static uint16_t glyph_index[UCG_FONT_GLYPH_INDEX_SIZE];
+
+/*! \brief  Device which accepts all messages and draws nothing */
+static ucg_int_t null_dev(ucg_t *ucg, ucg_int_t msg, void *data)
+{
+  switch (msg) {
+    case UCG_MSG_GET_DIMENSION:
+      ((ucg_wh_t *) data)->w = 160;
+      ((ucg_wh_t *) data)->h = 128;
+      return 1;
+    case UCG_MSG_WIN_OPEN:
+      return 1;
+  }
+  return ucg_dev_default_cb(ucg, msg, data);
+}
+
+static double now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/*! \brief  Looks up every encoding of the font BENCH_ROUNDS times
+ *  \param  ucg   pointer to ucg struct with the font set
+ *  \param  text  characters to look up
+ *  \return lookups per second
+ */
+static double bench_lookup(ucg_t *ucg, const char *text)
+{
+  volatile uintptr_t sink = 0;
+  const char *s;
+  long i, n = 0;
+  double t;
+
+  t = now();
+  for (i = 0; i < BENCH_ROUNDS; i++) {
+    for (s = text; *s != '\0'; s++) {
+      sink += (uintptr_t) ucg_font_get_glyph_data(ucg, (uint8_t) *s);
+      n++;
+    }
+  }
+  t = now() - t;
+
+  return n / t;
+}
+
+int main(void)
+{
+  static const char clock_text[] = "0123456789 :";
+  char all_text[256];
+  ucg_t ucg;
+  double lin, idx;
+  int i;
+
+  for (i = 0; i < 255; i++) {
+    all_text[i] = (char) (i + 1);
+  }
+  all_text[255] = '\0';
+
+  memset(&ucg, 0, sizeof(ucg));
+  ucg_SetFont(&ucg, ucg_font_fur35_hf);
+
+  lin = bench_lookup(&ucg, clock_text);
+  ucg_SetFontGlyphIndex(&ucg, glyph_index);
+  idx = bench_lookup(&ucg, clock_text);
+  printf("ucg_font_fur35_hf \"%s\": linear %10.0f lookups/s, index %10.0f lookups/s (x%.1f)\n",
+         clock_text, lin, idx, idx / lin);
+
+  ucg_SetFontGlyphIndex(&ucg, NULL);
+  lin = bench_lookup(&ucg, all_text);
+  ucg_SetFontGlyphIndex(&ucg, glyph_index);
+  idx = bench_lookup(&ucg, all_text);
+  printf("ucg_font_fur35_hf 1..255: linear %10.0f lookups/s, index %10.0f lookups/s (x%.1f)\n",
+         lin, idx, idx / lin);
+
+#if UCG_FONT_CACHE_ENTRIES > 0
+  {
+    static const char text[] = "12 : 34";
+    double t, cold, warm;
+    long n;
+
+    ucg_Init(&ucg, null_dev, ucg_ext_none, (ucg_com_fnptr) 0);
+    ucg_SetFont(&ucg, ucg_font_fur35_hf);
+    ucg_SetFontMode(&ucg, UCG_FONT_MODE_SOLID);
+
+    t = now();
+    for (n = 0; n < BENCH_ROUNDS; n++) {
+      ucg_ClearFontCache();
+      ucg_DrawString(&ucg, 7, 48, 0, text);
+    }
+    cold = BENCH_ROUNDS * (sizeof(text) - 1) / (now() - t);
+
+    memset(&ucg_font_cache_stat, 0, sizeof(ucg_font_cache_stat));
+    t = now();
+    for (n = 0; n < BENCH_ROUNDS; n++) {
+      ucg_DrawString(&ucg, 7, 48, 0, text);
+    }
+    warm = BENCH_ROUNDS * (sizeof(text) - 1) / (now() - t);
+
+    printf("ucg_font_fur35_hf \"%s\": cold cache %10.0f glyphs/s, warm cache %10.0f glyphs/s (x%.1f)\n",
+           text, cold, warm, warm / cold);
+    printf("glyph cache: %lu hits, %lu misses\n",
+           (unsigned long) ucg_font_cache_stat.hit, (unsigned long) ucg_font_cache_stat.miss);
+  }
+#endif
+
+  /* both lookups must agree */
+  for (i = 1; i < 256; i++) {
+    const uint8_t *p;
+    ucg_SetFontGlyphIndex(&ucg, NULL);
+    p = ucg_font_get_glyph_data(&ucg, (uint8_t) i);
+    ucg_SetFontGlyphIndex(&ucg, glyph_index);
+    if (p != ucg_font_get_glyph_data(&ucg, (uint8_t) i)) {
+      printf("mismatch for encoding %d\n", i);
+      return 1;
+    }
+  }
+
+  return 0;
+}
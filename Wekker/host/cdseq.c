@@ -0,0 +1,140 @@
+/*!
+ *  \file    cdseq.c
+ *  \brief   Host test of UCG_COM_MSG_SEND_CD_DATA_SEQUENCE
+ *
+ *  A CD/data sequence like the one of the glyph output of the drivers is sent
+ *  with ucg_com_SendCmdDataSequence(). The bytes for the ST7735 and the level of
+ *  the CD line are recorded and compared with a reference:
+ *
+ *  - control byte 1 sets CD low (command), 2 or any other value sets CD high (data),
+ *    0 keeps the level
+ *  - after the sequence, the CD line has the requested level, even if the
+ *    sequence has changed it behind the back of ucg_com_SetCDLineStatus()
+ *
+ *  The init sequence sent by ucg_InitAsync() and ucg_com_ResumeCmdSeq() is
+ *  compared with the one of ucg_Init(): the same bytes, suspended at every
+ *  UCG_DLY_MS() of the sequence.
+ *
+ *  ucg_com_host() decodes the control bytes with UCG_COM_CD_SEQ_LEVEL() of ucg.h,
+ *  the macro that the communication callback of the Xmega (xmega_transfer_cd_seq()
+ *  in ucglib_xmega_hal.c) uses too. The port and SPI/USART handling of the Xmega
+ *  is not tested on the host.
+ *
+ *  Build and run on the host (from the Wekker/host directory):
+ *
+ *      make run
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "ucg_host.h"
+
+// set x to 5, write one RGB565 pixel
+static const uint8_t seq[] = {
+  0x01, 0x2a,     // command: set x
+  0x02, 0x00,     // data
+  0x00, 0x05,
+  0x01, 0x2c,     // command: write to RAM
+  0x03, 0xf8,     // every control byte except 0 and 1 is data
+  0x00, 0x1f,
+};
+
+// a sequence that ends in command mode
+static const uint8_t seq_cmd[] = {
+  0x01, 0x00,     // command: no operation
+};
+
+// the recorded reference
+static const ucg_host_trace_t reference[] = {
+  { 1, 0x11 },
+  { 0, 0x2a }, { 1, 0x00 }, { 1, 0x05 }, { 0, 0x2c }, { 1, 0xf8 }, { 1, 0x1f },
+  { 1, 0x22 },
+  { 0, 0x00 },
+  { 1, 0x33 },
+};
+
+#define REF_CNT   (long) (sizeof(reference) / sizeof(reference[0]))
+
+/*! \brief  Compares the resumable init sequence with the blocking one
+ *
+ *  \return number of errors
+ */
+static long check_async(void)
+{
+  static ucg_host_trace_t ref[256], trace[256];
+  ucg_t ucg;
+  long  n_ref, n, i, err = 0;
+  int   steps = 0;
+  long  ms = 0;
+
+  memset(&ucg, 0, sizeof(ucg));
+  ucg_host_StartTrace(ref, 256);
+  ucg_Init(&ucg, ucg_dev_st7735_18x128x160, ucg_ext_st7735_18, ucg_com_host);
+  n_ref = ucg_host_StopTrace();
+
+  memset(&ucg, 0, sizeof(ucg));
+  ucg_host_StartTrace(trace, 256);
+  ucg_InitAsync(&ucg, ucg_dev_st7735_18x128x160, ucg_ext_st7735_18, ucg_com_host);
+  while (ucg.cmd_seq_resume != NULL) {
+    steps++;
+    ms += ucg.cmd_seq_delay;
+    ucg_com_ResumeCmdSeq(&ucg);
+  }
+  n = ucg_host_StopTrace();
+
+  if (n != n_ref) {
+    printf("cdseq: async init %ld bytes, expected %ld\n", n, n_ref);
+    err++;
+  }
+  for (i = 0; i < n && i < n_ref; i++) {
+    if (trace[i].cd != ref[i].cd || trace[i].b != ref[i].b) {
+      printf("cdseq: async init byte %ld is cd=%d 0x%02x, expected cd=%d 0x%02x\n",
+             i, trace[i].cd, trace[i].b, ref[i].cd, ref[i].b);
+      err++;
+    }
+  }
+  if (ucg.cmd_seq_async != 0 || ucg_GetWidth(&ucg) != 128 || ucg_GetHeight(&ucg) != 160) {
+    printf("cdseq: async init not completed\n");
+    err++;
+  }
+  printf("cdseq: async init %ld bytes, %d delays, %ld ms\n", n, steps, ms);
+
+  return err;
+}
+
+int main(void)
+{
+  ucg_t ucg;
+  ucg_host_trace_t trace[32];
+  long  n, i, err = 0;
+
+  memset(&ucg, 0, sizeof(ucg));
+  ucg_Init(&ucg, ucg_dev_st7735_18x128x160, ucg_ext_st7735_18, ucg_com_host);
+
+  ucg_host_StartTrace(trace, 32);
+  ucg_com_SetCSLineStatus(&ucg, 0);
+  ucg_com_SetCDLineStatus(&ucg, 1);
+  ucg_com_SendByte(&ucg, 0x11);
+  ucg_com_SendCmdDataSequence(&ucg, sizeof(seq) / 2, seq, 1);
+  ucg_com_SendByte(&ucg, 0x22);
+  ucg_com_SendCmdDataSequence(&ucg, sizeof(seq_cmd) / 2, seq_cmd, 1);
+  ucg_com_SendByte(&ucg, 0x33);
+  ucg_com_SetCSLineStatus(&ucg, 1);
+  n = ucg_host_StopTrace();
+
+  if (n != REF_CNT) {
+    printf("cdseq: %ld bytes, expected %ld\n", n, REF_CNT);
+    err++;
+  }
+  for (i = 0; i < n && i < REF_CNT; i++) {
+    if (trace[i].cd != reference[i].cd || trace[i].b != reference[i].b) {
+      printf("cdseq: byte %ld is cd=%d 0x%02x, expected cd=%d 0x%02x\n",
+             i, trace[i].cd, trace[i].b, reference[i].cd, reference[i].b);
+      err++;
+    }
+  }
+  err += check_async();
+  printf("cdseq: %s\n", err ? "FAILED" : "ok");
+
+  return err != 0;
+}
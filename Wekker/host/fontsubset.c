@@ -0,0 +1,632 @@
+/*!
+ *  \file    fontsubset.c
+ *  \brief   Host tool: writes the fonts of the application with only the used glyphs
+ *
+ *  The fonts and the characters are declared in a list (../font_subset.txt),
+ *  one font per line:
+ *
+ *      ucg_font_fur35_hf "0123456789 :"
+ *
+ *  The characters are a C string, escapes: \\, \" and \xNN. Empty lines
+ *  and lines starting with # are skipped. The option "expanded" after the
+ *  characters converts the glyphs from bit packed run length code to byte
+ *  pairs (more flash, faster drawing, see UCG_FONT_BBX_MODE_EXPANDED in ucg.h):
+ *
+ *      ucg_font_fur35_hf "0123456789 :" expanded
+ *
+ *  The font data is read from the ucglib font files (ucg_vector_font_data.c,
+ *  ucg_pixel_font_data.c). The trimmed fonts have the same names and the same
+ *  header, only the glyph count, the start positions of 'A' and 'a' and for
+ *  expanded fonts the bbx_mode are updated. The output file replaces the font files in the project.
+ *
+ *  For every font the size and the number of glyphs, which are scanned by the
+ *  linear search of ucg_font_get_glyph_data() for the declared characters, are
+ *  reported, and the lookups per second on the host. The glyphs of the subset
+ *  are compared with the original font. Converted glyphs are drawn with both
+ *  formats, solid and transparent in all directions, into the framebuffer device
+ *  and the emulated ST7735 (ucg_host.c) and the pixel are compared. For these
+ *  fonts the glyphs per second of both formats are reported.
+ *
+ *  Build and run on the host (from the Wekker/host directory):
+ *
+ *      make subset
+ *
+ *  which is
+ *
+ *      ./fontsubset ../font_subset.txt ../font_subset.c ../csrc/ucg_vector_font_data.c ...
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "ucg.h"
+#include "ucg_host.h"
+
+#define FONT_MAX        16            //!< maximum number of fonts in the list
+#define FONT_HEADER     21            //!< size of the font header, UCG_FONT_DATA_STRUCT_SIZE in ucg_font.c
+#define LOOKUP_ROUNDS   100000        //!< rounds of the lookup measurement
+#define DRAW_ROUNDS     2000          //!< rounds of the glyph drawing measurement
+
+const uint8_t *ucg_font_get_glyph_data(ucg_t *ucg, uint8_t encoding);
+uint8_t ucg_font_decode_get_unsigned_bits(ucg_font_decode_t *f, uint8_t cnt);
+int8_t  ucg_font_decode_get_signed_bits(ucg_font_decode_t *f, uint8_t cnt);
+
+/*!
+ * A font of the list
+ */
+typedef struct {
+  char     name[64];        //!< name of the font array
+  uint8_t  used[256];       //!< 1 for the declared characters
+  uint8_t  text[257];       //!< the declared characters, zero terminated
+  uint8_t *data;            //!< the original font
+  long     size;
+  uint8_t *subset;          //!< the trimmed font
+  long     subset_size;
+  int      is_expanded;     //!< convert the glyphs to the expanded format
+  long     rle_size;        //!< size of the trimmed font with bit packed run length code
+} font_t;
+
+static font_t font[FONT_MAX];
+static int    font_cnt;
+
+static double now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/*! \brief  Reads a complete file
+ *  \param  name   file name
+ *  \return zero terminated content, NULL if the file can't be read
+ */
+static char *read_file(const char *name)
+{
+  FILE *f = fopen(name, "rb");
+  char *buf;
+  long  n;
+
+  if (f == NULL) return NULL;
+  fseek(f, 0, SEEK_END);
+  n = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  buf = malloc(n + 1);
+  if (buf != NULL && fread(buf, 1, n, f) == (size_t) n) {
+    buf[n] = '\0';
+  } else {
+    free(buf);
+    buf = NULL;
+  }
+  fclose(f);
+
+  return buf;
+}
+
+/*! \brief  Reads the list of fonts and characters
+ *  \param  name   file name
+ *  \return 0 if ok
+ */
+static int read_list(const char *name)
+{
+  char *buf = read_file(name);
+  char *line, *p;
+  int   n, c, lineno = 0;
+
+  if (buf == NULL) {
+    fprintf(stderr, "fontsubset: can't read %s\n", name);
+    return 1;
+  }
+
+  for (line = strtok(buf, "\n"); line != NULL; line = strtok(NULL, "\n")) {
+    font_t *f;
+
+    lineno++;
+    p = line + strspn(line, " \t\r");
+    if (*p == '\0' || *p == '#') continue;
+    if (font_cnt >= FONT_MAX) {
+      fprintf(stderr, "fontsubset: more than %d fonts\n", FONT_MAX);
+      return 1;
+    }
+    f = &font[font_cnt++];
+    memset(f, 0, sizeof(*f));
+    if (sscanf(p, "%63s", f->name) != 1 || (p = strchr(p, '"')) == NULL) {
+      fprintf(stderr, "%s:%d: expected: font \"characters\"\n", name, lineno);
+      return 1;
+    }
+    for (p++, n = 0; *p != '"'; p++) {
+      c = (uint8_t) *p;
+      if (c == '\0') {
+        fprintf(stderr, "%s:%d: missing \"\n", name, lineno);
+        return 1;
+      }
+      if (c == '\\') {
+        p++;
+        if (*p == 'x') {
+          c = (int) strtol(p + 1, &p, 16);
+          p--;
+        } else {
+          c = (uint8_t) *p;
+        }
+      }
+      if (c == 0 || f->used[c]) continue;
+      f->used[c] = 1;
+      f->text[n++] = c;
+    }
+    p += 1 + strspn(p + 1, " \t\r");
+    if (strncmp(p, "expanded", 8) == 0) {
+      f->is_expanded = 1;
+    } else if (*p != '\0' && *p != '#') {
+      fprintf(stderr, "%s:%d: unknown option %s\n", name, lineno, p);
+      return 1;
+    }
+  }
+
+  free(buf);
+  return 0;
+}
+
+/*! \brief  Searches a font array in the source of a font file
+ *  \param  src    source of the font file
+ *  \param  f      the font, data and size are set
+ *  \return 1 if found
+ */
+static int find_font(const char *src, font_t *f)
+{
+  char        pattern[sizeof(f->name) + 2];   // " name["
+  const char *p;
+  long        n = 0, cap = 1024;
+
+  if (snprintf(pattern, sizeof(pattern), " %s[", f->name) >= (int) sizeof(pattern)) return 0;
+  p = strstr(src, pattern);
+  if (p == NULL) return 0;
+  p = strstr(p, "= {");
+  if (p == NULL) return 0;
+  p += 3;
+
+  f->data = malloc(cap);
+  for (;;) {
+    char *end;
+    long  v;
+
+    p += strspn(p, " \t\r\n,");
+    if (*p == '}') break;
+    v = strtol(p, &end, 0);
+    if (end == p) {
+      free(f->data);
+      f->data = NULL;
+      return 0;
+    }
+    if (n == cap) {
+      cap *= 2;
+      f->data = realloc(f->data, cap);
+    }
+    f->data[n++] = (uint8_t) v;
+    p = end;
+  }
+  f->size = n;
+
+  return 1;
+}
+
+/*! \brief  Builds the trimmed font: header, the declared glyphs, end marker
+ *  \param  f      the font
+ */
+static void make_subset(font_t *f)
+{
+  const uint8_t *g = f->data + FONT_HEADER;
+  uint8_t       *s;
+  long           pos = 0;
+  int            cnt = 0, has_A = 0, has_a = 0;
+
+  f->subset = malloc(f->size);
+  memcpy(f->subset, f->data, FONT_HEADER);
+  s = f->subset + FONT_HEADER;
+
+  for (; g[1] != 0; g += g[1]) {
+    if (!has_A && g[0] >= 'A') {
+      f->subset[17] = pos >> 8;
+      f->subset[18] = pos & 255;
+      has_A = 1;
+    }
+    if (!has_a && g[0] >= 'a') {
+      f->subset[19] = pos >> 8;
+      f->subset[20] = pos & 255;
+      has_a = 1;
+    }
+    if (!f->used[g[0]]) continue;
+    memcpy(s + pos, g, g[1]);
+    pos += g[1];
+    cnt++;
+  }
+
+  // 'A' or 'a' after the last glyph: the search starts at the end marker
+  if (!has_A) {
+    f->subset[17] = pos >> 8;
+    f->subset[18] = pos & 255;
+  }
+  if (!has_a) {
+    f->subset[19] = pos >> 8;
+    f->subset[20] = pos & 255;
+  }
+  s[pos++] = 0;
+  s[pos++] = 0;
+
+  f->subset[0] = cnt;
+  f->subset_size = FONT_HEADER + pos;
+}
+
+/*! \brief  Converts a glyph from run length code to the expanded format
+ *  \param  font   the font data, for the RLE parameters of the header
+ *  \param  g      the glyph with run length code
+ *  \param  out    the expanded glyph, see ucg_font.c
+ *  \return size of the expanded glyph, 0 if it is larger than 255 bytes
+ */
+static int glyph_expand(const uint8_t *font, const uint8_t *g, uint8_t *out)
+{
+  ucg_font_decode_t d;
+  int w, h, pos = 0, size = 7;
+  int a, b;
+
+  memset(&d, 0, sizeof(d));
+  d.decode_ptr = g + 2;
+  w = ucg_font_decode_get_unsigned_bits(&d, font[4]);
+  h = ucg_font_decode_get_unsigned_bits(&d, font[5]);
+  out[0] = g[0];
+  out[2] = w;
+  out[3] = h;
+  out[4] = (uint8_t) ucg_font_decode_get_signed_bits(&d, font[6]);
+  out[5] = (uint8_t) ucg_font_decode_get_signed_bits(&d, font[7]);
+  out[6] = (uint8_t) ucg_font_decode_get_signed_bits(&d, font[8]);
+
+  // same loop as ucg_font_decode_glyph(), the pairs are copied
+  while (w > 0 && pos < w * h) {
+    a = ucg_font_decode_get_unsigned_bits(&d, font[2]);
+    b = ucg_font_decode_get_unsigned_bits(&d, font[3]);
+    do {
+      if (size + 2 > 255) return 0;
+      out[size++] = a;
+      out[size++] = b;
+      pos += a + b;
+    } while (ucg_font_decode_get_unsigned_bits(&d, 1) != 0);
+  }
+  out[1] = size;
+
+  return size;
+}
+
+/*! \brief  Converts the glyphs of the trimmed font to the expanded format
+ *  \param  f      the font
+ *  \return 0 if ok
+ */
+static int make_expanded(font_t *f)
+{
+  const uint8_t *g;
+  uint8_t       *s, *out;
+  long           pos = 0;
+  int            n, has_A = 0, has_a = 0;
+
+  out = malloc(FONT_HEADER + (long) f->subset[0] * 255 + 2);
+  memcpy(out, f->subset, FONT_HEADER);
+  out[1] |= UCG_FONT_BBX_MODE_EXPANDED;
+  s = out + FONT_HEADER;
+
+  for (g = f->subset + FONT_HEADER; g[1] != 0; g += g[1]) {
+    if (!has_A && g[0] >= 'A') {
+      out[17] = pos >> 8;
+      out[18] = pos & 255;
+      has_A = 1;
+    }
+    if (!has_a && g[0] >= 'a') {
+      out[19] = pos >> 8;
+      out[20] = pos & 255;
+      has_a = 1;
+    }
+    n = glyph_expand(f->subset, g, s + pos);
+    if (n == 0) {
+      fprintf(stderr, "fontsubset: %s: glyph 0x%02x is too large for the expanded format\n",
+              f->name, g[0]);
+      free(out);
+      return 1;
+    }
+    pos += n;
+  }
+  if (!has_A) {
+    out[17] = pos >> 8;
+    out[18] = pos & 255;
+  }
+  if (!has_a) {
+    out[19] = pos >> 8;
+    out[20] = pos & 255;
+  }
+  s[pos++] = 0;
+  s[pos++] = 0;
+
+  f->rle_size = f->subset_size;
+  free(f->subset);
+  f->subset = out;
+  f->subset_size = FONT_HEADER + pos;
+
+  return 0;
+}
+
+/*! \brief  Number of glyphs scanned by the linear search for the declared characters
+ *  \param  font   the font data
+ *  \param  text   the characters
+ *  \return glyphs per lookup
+ */
+static double scan_glyphs(const uint8_t *font, const uint8_t *text)
+{
+  const uint8_t *g;
+  long           n = 0, cnt = 0;
+
+  for (; *text != 0; text++, cnt++) {
+    g = font + FONT_HEADER;
+    if (*text >= 'a') {
+      g += (font[19] << 8) | font[20];
+    } else if (*text >= 'A') {
+      g += (font[17] << 8) | font[18];
+    }
+    for (; g[1] != 0; g += g[1]) {
+      n++;
+      if (g[0] == *text) break;
+    }
+  }
+
+  return cnt ? (double) n / cnt : 0.0;
+}
+
+/*! \brief  Measures the lookups per second of ucg_font_get_glyph_data()
+ *  \param  font   the font data
+ *  \param  text   the characters
+ *  \return lookups per second
+ */
+static double bench_lookup(const uint8_t *font, const uint8_t *text)
+{
+  volatile uintptr_t sink = 0;
+  const uint8_t *s;
+  ucg_t  ucg;
+  long   i, n = 0;
+  double t;
+
+  memset(&ucg, 0, sizeof(ucg));
+  ucg_SetFont(&ucg, font);
+
+  t = now();
+  for (i = 0; i < LOOKUP_ROUNDS; i++) {
+    for (s = text; *s != 0; s++) {
+      sink += (uintptr_t) ucg_font_get_glyph_data(&ucg, *s);
+      n++;
+    }
+  }
+
+  return n / (now() - t);
+}
+
+/*! \brief  Compares the glyphs of the subset with the original font
+ *  \param  f      the font
+ *  \return number of errors
+ */
+static int check_subset(font_t *f)
+{
+  const uint8_t *p, *q;
+  ucg_t ucg_org, ucg_sub;
+  int   c, err = 0;
+
+  memset(&ucg_org, 0, sizeof(ucg_org));
+  memset(&ucg_sub, 0, sizeof(ucg_sub));
+  ucg_SetFont(&ucg_org, f->data);
+  ucg_SetFont(&ucg_sub, f->subset);
+
+  for (c = 1; c < 256; c++) {
+    p = ucg_font_get_glyph_data(&ucg_org, c);
+    q = ucg_font_get_glyph_data(&ucg_sub, c);
+    if (!f->used[c]) {
+      if (q != NULL) err++;
+      continue;
+    }
+    if (p == NULL) {
+      printf("%s: character 0x%02x is not in the font\n", f->name, c);
+      continue;
+    }
+    if (q == NULL || (!f->is_expanded && memcmp(p, q, p[1]) != 0)) {
+      printf("%s: glyph 0x%02x differs\n", f->name, c);
+      err++;
+    }
+  }
+
+  return err;
+}
+
+/*! \brief  Draws the glyphs of the original font into the framebuffer device and
+ *          the glyphs of the expanded font into the emulated ST7735, the pixel must be equal
+ *  \param  f      the font
+ *  \return number of errors
+ */
+static int check_expanded(font_t *f)
+{
+  const uint8_t *s;
+  ucg_t fb, lcd;
+  int   mode, dir, err = 0;
+  long  diff;
+
+  ucg_Init(&fb, ucg_dev_host_fb, ucg_ext_none, (ucg_com_fnptr) 0);
+  ucg_Init(&lcd, ucg_dev_st7735_18x128x160, ucg_ext_st7735_18, ucg_com_host);
+  ucg_SetFont(&fb, f->data);
+  ucg_SetFont(&lcd, f->subset);
+  ucg_SetColor(&fb, 0, 255, 255, 255);
+  ucg_SetColor(&lcd, 0, 255, 255, 255);
+  ucg_SetColor(&fb, 1, 0, 0, 255);
+  ucg_SetColor(&lcd, 1, 0, 0, 255);
+
+  for (s = f->text; *s != 0; s++) {
+    for (mode = 0; mode < 2; mode++) {
+      ucg_SetFontMode(&fb, mode ? UCG_FONT_MODE_TRANSPARENT : UCG_FONT_MODE_SOLID);
+      ucg_SetFontMode(&lcd, mode ? UCG_FONT_MODE_TRANSPARENT : UCG_FONT_MODE_SOLID);
+      for (dir = 0; dir < 4; dir++) {
+        ucg_host_ClearBuffers();
+        if (ucg_DrawGlyph(&fb, 64, 80, dir, *s) != ucg_DrawGlyph(&lcd, 64, 80, dir, *s) ||
+            ucg_GetGlyphWidth(&fb, *s) != ucg_GetGlyphWidth(&lcd, *s)) {
+          printf("%s: delta x of glyph 0x%02x differs\n", f->name, *s);
+          err++;
+        }
+        diff = ucg_host_Diff();
+        if (diff != 0) {
+          printf("%s: glyph 0x%02x %s dir %d: %ld pixel differ\n", f->name, *s,
+                 mode ? "transparent" : "solid", dir, diff);
+          err++;
+        }
+      }
+    }
+  }
+
+  return err;
+}
+
+/*! \brief  Device which accepts all messages and draws nothing */
+static ucg_int_t null_dev(ucg_t *ucg, ucg_int_t msg, void *data)
+{
+  switch (msg) {
+    case UCG_MSG_GET_DIMENSION:
+      ((ucg_wh_t *) data)->w = 128;
+      ((ucg_wh_t *) data)->h = 160;
+      return 1;
+    case UCG_MSG_WIN_OPEN:
+      return 1;
+  }
+  return ucg_dev_default_cb(ucg, msg, data);
+}
+
+/*! \brief  Measures the glyphs per second of ucg_DrawString(), solid mode
+ *  \param  font   the font data
+ *  \param  text   the characters
+ *  \param  cold   clear the glyph cache before every string
+ *  \return glyphs per second
+ */
+static double bench_draw(const uint8_t *font, const uint8_t *text, int cold)
+{
+  ucg_t  ucg;
+  long   i, n = 0;
+  double t;
+
+  ucg_Init(&ucg, null_dev, ucg_ext_none, (ucg_com_fnptr) 0);
+  ucg_SetFont(&ucg, font);
+  ucg_SetFontMode(&ucg, UCG_FONT_MODE_SOLID);
+
+  t = now();
+  for (i = 0; i < DRAW_ROUNDS; i++) {
+#if UCG_FONT_CACHE_ENTRIES > 0
+    if (cold) ucg_ClearFontCache();
+#endif
+    ucg_DrawString(&ucg, 0, 100, 0, (const char *) text);
+    n += strlen((const char *) text);
+  }
+
+  return n / (now() - t);
+}
+
+/*! \brief  Writes the trimmed fonts as C source
+ *  \param  name   file name
+ *  \param  list   name of the list, for the comment
+ *  \return 0 if ok
+ */
+static int write_fonts(const char *name, const char *list)
+{
+  FILE *f = fopen(name, "w");
+  long  i;
+  int   k;
+
+  if (f == NULL) {
+    fprintf(stderr, "fontsubset: can't write %s\n", name);
+    return 1;
+  }
+
+  fprintf(f, "#include \"csrc/ucg.h\"\n");
+  fprintf(f, "/*\n");
+  fprintf(f, "  Fonts of the Alarm firmware with the glyphs of %s.\n", list);
+  fprintf(f, "  This file has been generated by host/fontsubset.c (make subset), do not edit.\n");
+  fprintf(f, "*/\n");
+  for (k = 0; k < font_cnt; k++) {
+    fprintf(f, "/*\n");
+    fprintf(f, "  Fontname: %s\n", font[k].name);
+    fprintf(f, "  Glyphs: %d/%d\n", font[k].subset[0], font[k].data[0]);
+    fprintf(f, "  BBX Build Mode: %d%s\n", font[k].subset[1] & ~UCG_FONT_BBX_MODE_EXPANDED,
+            font[k].is_expanded ? ", expanded glyphs" : "");
+    fprintf(f, "*/\n");
+    fprintf(f, "const ucg_fntpgm_uint8_t %s[%ld] UCG_FONT_SECTION(\"%s\") = {",
+            font[k].name, font[k].subset_size, font[k].name);
+    for (i = 0; i < font[k].subset_size; i++) {
+      fprintf(f, "%s%d", i == 0 ? "\n  " : (i % 16 == 0 ? ",\n  " : ","), font[k].subset[i]);
+    }
+    fprintf(f, "\n};\n");
+  }
+
+  fclose(f);
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  long size = 0, subset_size = 0;
+  int  i, k, err = 0;
+
+  if (argc < 4) {
+    fprintf(stderr, "usage: fontsubset list.txt output.c fontfile.c ...\n");
+    return 2;
+  }
+  if (read_list(argv[1]) != 0) return 1;
+
+  for (i = 3; i < argc; i++) {
+    char *src = read_file(argv[i]);
+
+    if (src == NULL) {
+      fprintf(stderr, "fontsubset: can't read %s\n", argv[i]);
+      return 1;
+    }
+    for (k = 0; k < font_cnt; k++) {
+      if (font[k].data == NULL) find_font(src, &font[k]);
+    }
+    free(src);
+  }
+
+  printf("%-20s %7s %7s %7s %10s %10s %14s %14s\n", "font", "glyphs", "bytes", "subset",
+         "scan org", "scan sub", "org lookup/s", "sub lookup/s");
+  for (k = 0; k < font_cnt; k++) {
+    font_t *f = &font[k];
+
+    if (f->data == NULL) {
+      fprintf(stderr, "fontsubset: font %s not found\n", f->name);
+      return 1;
+    }
+    make_subset(f);
+    if (f->is_expanded && make_expanded(f) != 0) return 1;
+    err += check_subset(f);
+    size += f->size;
+    subset_size += f->subset_size;
+    printf("%-20s %3d/%-3d %7ld %7ld %10.1f %10.1f %14.0f %14.0f\n", f->name,
+           f->subset[0], f->data[0], f->size, f->subset_size,
+           scan_glyphs(f->data, f->text), scan_glyphs(f->subset, f->text),
+           bench_lookup(f->data, f->text), bench_lookup(f->subset, f->text));
+  }
+  printf("%-20s %7s %7ld %7ld  flash saved: %ld bytes\n", "total", "", size, subset_size,
+         size - subset_size);
+
+  for (k = 0; k < font_cnt; k++) {
+    font_t *f = &font[k];
+
+    if (!f->is_expanded) continue;
+    err += check_expanded(f);
+    printf("%-20s expanded: %ld bytes (rle %ld), rle %.0f glyphs/s (cold cache), "
+           "%.0f glyphs/s (warm cache), expanded %.0f glyphs/s\n", f->name, f->subset_size, f->rle_size,
+           bench_draw(f->data, f->text, 1), bench_draw(f->data, f->text, 0),
+           bench_draw(f->subset, f->text, 0));
+  }
+
+  if (err != 0) {
+    printf("fontsubset: %d errors\n", err);
+    return 1;
+  }
+
+  return write_fonts(argv[2], argv[1]);
+}
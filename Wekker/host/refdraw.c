@@ -0,0 +1,414 @@
+/*!
+ *  \file    refdraw.c
+ *  \brief   Host test of the drawing procedures against the baseline implementations
+ *
+ *  Random lines are drawn with ucg_DrawLine() and with a copy of the baseline
+ *  ucglib procedure, which steps through every pixel of the line with Bresenham
+ *  and draws it with ucg_DrawPixelWithArg(). Both must set the same pixel. The
+ *  baseline subtracted (uint8_t)dy, the copy subtracts dy: lines with a minor
+ *  delta of 256 or more were wrong in the baseline and are equal to the new
+ *  procedure with this fix.
+ *
+ *  Random discs, quarter discs (any combination of the UCG_DRAW_* quarters) and
+ *  rounded boxes are drawn with ucg_DrawDisc() and ucg_DrawRBox() and with copies
+ *  of the baseline procedures, which draw every disc as vertical lines for each
+ *  step of the circle and a rounded box as four quarter discs and three boxes.
+ *  The radius includes the fallback to the baseline procedures above
+ *  UCG_DISC_ROWS_MAX_RAD and rounded boxes with overlapping corners.
+ *
+ *  The shapes are inside and outside of the display, the clip range is random
+ *  and the display is not rotated and rotated by ucg_SetRotate90().
+ *
+ *  Build and run on the host (from the Wekker/host directory):
+ *
+ *      make run
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ucg.h"
+
+#define REF_WIDTH     128     //!< width of the test device
+#define REF_HEIGHT    160     //!< height of the test device
+#define REF_ROUNDS    20000   //!< random shapes per test and rotation
+
+static uint8_t img[2][REF_HEIGHT][REF_WIDTH];    //!< pixel of the new and the reference procedure
+static uint8_t img_idx;                          //!< image that is drawn
+
+/*! \brief  Device that marks the visible pixel in img[img_idx], all lines are drawn pixel by pixel
+ */
+static ucg_int_t dev_mark(ucg_t *ucg, ucg_int_t msg, void *data)
+{
+  switch (msg) {
+    case UCG_MSG_DEV_POWER_UP:
+    case UCG_MSG_DEV_POWER_DOWN:
+      return 1;
+    case UCG_MSG_GET_DIMENSION:
+      ((ucg_wh_t *) data)->w = REF_WIDTH;
+      ((ucg_wh_t *) data)->h = REF_HEIGHT;
+      return 1;
+    case UCG_MSG_DRAW_PIXEL:
+      if (ucg_clip_is_pixel_visible(ucg)) {
+        img[img_idx][ucg->arg.pixel.pos.y][ucg->arg.pixel.pos.x] = 1;
+      }
+      return 1;
+    case UCG_MSG_DRAW_L90FX:
+      ucg_handle_l90fx(ucg, dev_mark);
+      return 1;
+  }
+
+  return ucg_dev_default_cb(ucg, msg, data);
+}
+
+/*! \brief  Random number in [lo, hi]
+ */
+static ucg_int_t rnd(ucg_int_t lo, ucg_int_t hi)
+{
+  return lo + rand() % (hi - lo + 1);
+}
+
+/*! \brief  Sets a random clip range, sometimes the complete display
+ */
+static void set_random_clip(ucg_t *ucg)
+{
+  ucg_int_t x, y;
+
+  if (rand() % 4 == 0) {
+    ucg_SetMaxClipRange(ucg);
+    return;
+  }
+  x = rnd(0, ucg_GetWidth(ucg) - 1);
+  y = rnd(0, ucg_GetHeight(ucg) - 1);
+  ucg_SetClipRange(ucg, x, y, rnd(1, ucg_GetWidth(ucg) - x), rnd(1, ucg_GetHeight(ucg) - y));
+}
+
+/////////////////////////////////////////////////
+
+/*! \brief  ucg_DrawLine() of the baseline ucglib, (uint8_t)dy is replaced by dy
+ */
+static void ref_line(ucg_t *ucg, ucg_int_t x1, ucg_int_t y1, ucg_int_t x2, ucg_int_t y2)
+{
+  ucg_int_t tmp;
+  ucg_int_t x,y;
+  ucg_int_t dx, dy;
+  ucg_int_t err;
+  ucg_int_t ystep;
+
+  uint8_t swapxy = 0;
+
+  ucg->arg.pixel.rgb = ucg->arg.rgb[0];
+
+  if ( x1 > x2 ) dx = x1-x2; else dx = x2-x1;
+  if ( y1 > y2 ) dy = y1-y2; else dy = y2-y1;
+
+  if ( dy > dx )
+  {
+    swapxy = 1;
+    tmp = dx; dx =dy; dy = tmp;
+    tmp = x1; x1 =y1; y1 = tmp;
+    tmp = x2; x2 =y2; y2 = tmp;
+  }
+  if ( x1 > x2 )
+  {
+    tmp = x1; x1 =x2; x2 = tmp;
+    tmp = y1; y1 =y2; y2 = tmp;
+  }
+  err = dx >> 1;
+  if ( y2 > y1 ) ystep = 1; else ystep = -1;
+  y = y1;
+  for( x = x1; x <= x2; x++ )
+  {
+    if ( swapxy == 0 )
+    {
+      ucg->arg.pixel.pos.x = x;
+      ucg->arg.pixel.pos.y = y;
+    }
+    else
+    {
+      ucg->arg.pixel.pos.x = y;
+      ucg->arg.pixel.pos.y = x;
+    }
+    ucg_DrawPixelWithArg(ucg);
+    err -= dy;
+    if ( err < 0 )
+    {
+      y += ystep;
+      err += dx;
+    }
+  }
+}
+
+/*! \brief  Draws random lines with ucg_DrawLine() and ref_line()
+ *
+ *  \return number of lines with different pixel
+ */
+static long check_lines(ucg_t *ucg)
+{
+  ucg_int_t x1, y1, x2, y2;
+  long i, err = 0;
+
+  for (i = 0; i < REF_ROUNDS; i++) {
+    set_random_clip(ucg);
+    x1 = rnd(-40, ucg_GetWidth(ucg) + 40);
+    y1 = rnd(-40, ucg_GetHeight(ucg) + 40);
+    switch (rand() % 3) {
+      case 0:                        // short lines
+        x2 = x1 + rnd(-20, 20);
+        y2 = y1 + rnd(-20, 20);
+        break;
+      case 1:                        // through the display
+        x2 = rnd(-40, ucg_GetWidth(ucg) + 40);
+        y2 = rnd(-40, ucg_GetHeight(ucg) + 40);
+        break;
+      default:                       // long lines, the minor delta may be 256 or more
+        x2 = x1 + rnd(-600, 600);
+        y2 = y1 + rnd(-600, 600);
+        break;
+    }
+
+    memset(img, 0, sizeof(img));
+    img_idx = 0;
+    ucg_DrawLine(ucg, x1, y1, x2, y2);
+    img_idx = 1;
+    ref_line(ucg, x1, y1, x2, y2);
+    if (memcmp(img[0], img[1], sizeof(img[0])) != 0) {
+      if (err < 5) {
+        printf("refdraw: line %d,%d - %d,%d differs\n", x1, y1, x2, y2);
+      }
+      err++;
+    }
+  }
+
+  return err;
+}
+
+/////////////////////////////////////////////////
+
+/*! \brief  ucg_draw_disc_section() of the baseline ucglib
+ */
+static void ref_disc_section(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t x0, ucg_int_t y0, uint8_t option)
+{
+    /* upper right */
+    if ( option & UCG_DRAW_UPPER_RIGHT )
+    {
+      ucg_DrawVLine(ucg, x0+x, y0-y, y+1);
+      ucg_DrawVLine(ucg, x0+y, y0-x, x+1);
+    }
+
+    /* upper left */
+    if ( option & UCG_DRAW_UPPER_LEFT )
+    {
+      ucg_DrawVLine(ucg, x0-x, y0-y, y+1);
+      ucg_DrawVLine(ucg, x0-y, y0-x, x+1);
+    }
+
+    /* lower right */
+    if ( option & UCG_DRAW_LOWER_RIGHT )
+    {
+      ucg_DrawVLine(ucg, x0+x, y0, y+1);
+      ucg_DrawVLine(ucg, x0+y, y0, x+1);
+    }
+
+    /* lower left */
+    if ( option & UCG_DRAW_LOWER_LEFT )
+    {
+      ucg_DrawVLine(ucg, x0-x, y0, y+1);
+      ucg_DrawVLine(ucg, x0-y, y0, x+1);
+    }
+}
+
+/*! \brief  ucg_DrawDisc() of the baseline ucglib
+ */
+static void ref_disc(ucg_t *ucg, ucg_int_t x0, ucg_int_t y0, ucg_int_t rad, uint8_t option)
+{
+  ucg_int_t f;
+  ucg_int_t ddF_x;
+  ucg_int_t ddF_y;
+  ucg_int_t x;
+  ucg_int_t y;
+
+  f = 1;
+  f -= rad;
+  ddF_x = 1;
+  ddF_y = 0;
+  ddF_y -= rad;
+  ddF_y *= 2;
+  x = 0;
+  y = rad;
+
+  ref_disc_section(ucg, x, y, x0, y0, option);
+
+  while ( x < y )
+  {
+    if (f >= 0)
+    {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+
+    ref_disc_section(ucg, x, y, x0, y0, option);
+  }
+}
+
+/*! \brief  ucg_DrawBox() of the baseline ucglib
+ */
+static void ref_box(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t w, ucg_int_t h)
+{
+  while( h > 0 )
+  {
+    ucg_DrawHLine(ucg, x, y, w);
+    h--;
+    y++;
+  }
+}
+
+/*! \brief  ucg_DrawRBox() of the baseline ucglib
+ */
+static void ref_rbox(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t w, ucg_int_t h, ucg_int_t r)
+{
+  ucg_int_t xl, yu;
+  ucg_int_t yl, xr;
+
+  xl = x;
+  xl += r;
+  yu = y;
+  yu += r;
+
+  xr = x;
+  xr += w;
+  xr -= r;
+  xr -= 1;
+
+  yl = y;
+  yl += h;
+  yl -= r;
+  yl -= 1;
+
+  ref_disc(ucg, xl, yu, r, UCG_DRAW_UPPER_LEFT);
+  ref_disc(ucg, xr, yu, r, UCG_DRAW_UPPER_RIGHT);
+  ref_disc(ucg, xl, yl, r, UCG_DRAW_LOWER_LEFT);
+  ref_disc(ucg, xr, yl, r, UCG_DRAW_LOWER_RIGHT);
+
+  {
+    ucg_int_t ww, hh;
+
+    ww = w;
+    ww -= r;
+    ww -= r;
+    ww -= 2;
+    hh = h;
+    hh -= r;
+    hh -= r;
+    hh -= 2;
+
+    xl++;
+    yu++;
+    h--;
+    ref_box(ucg, xl, y, ww, r+1);
+    ref_box(ucg, xl, yl, ww, r+1);
+    ref_box(ucg, x, yu, w, hh);
+  }
+}
+
+/*! \brief  Draws random discs and quarter discs with ucg_DrawDisc() and ref_disc()
+ *
+ *  \return number of discs with different pixel
+ */
+static long check_discs(ucg_t *ucg)
+{
+  ucg_int_t x0, y0, rad;
+  uint8_t option;
+  long i, err = 0;
+
+  for (i = 0; i < REF_ROUNDS; i++) {
+    set_random_clip(ucg);
+    x0 = rnd(-40, ucg_GetWidth(ucg) + 40);
+    y0 = rnd(-40, ucg_GetHeight(ucg) + 40);
+    rad = rand() % 8 ? rnd(0, 30) : rnd(UCG_DISC_ROWS_MAX_RAD - 4, UCG_DISC_ROWS_MAX_RAD + 30);
+    option = rand() % 2 ? UCG_DRAW_ALL : rnd(1, UCG_DRAW_ALL);
+
+    memset(img, 0, sizeof(img));
+    img_idx = 0;
+    ucg_DrawDisc(ucg, x0, y0, rad, option);
+    img_idx = 1;
+    ref_disc(ucg, x0, y0, rad, option);
+    if (memcmp(img[0], img[1], sizeof(img[0])) != 0) {
+      if (err < 5) {
+        printf("refdraw: disc %d,%d r=%d option=0x%02x differs\n", x0, y0, rad, option);
+      }
+      err++;
+    }
+  }
+
+  return err;
+}
+
+/*! \brief  Draws random rounded boxes with ucg_DrawRBox() and ref_rbox()
+ *
+ *  \return number of boxes with different pixel
+ */
+static long check_rboxes(ucg_t *ucg)
+{
+  ucg_int_t x, y, w, h, r;
+  long i, err = 0;
+
+  for (i = 0; i < REF_ROUNDS; i++) {
+    set_random_clip(ucg);
+    x = rnd(-60, ucg_GetWidth(ucg) + 20);
+    y = rnd(-60, ucg_GetHeight(ucg) + 20);
+    w = rnd(1, 120);
+    h = rnd(1, 120);
+    r = rand() % 8 ? rnd(0, 20) : rnd(0, UCG_DISC_ROWS_MAX_RAD + 10);
+
+    memset(img, 0, sizeof(img));
+    img_idx = 0;
+    ucg_DrawRBox(ucg, x, y, w, h, r);
+    img_idx = 1;
+    ref_rbox(ucg, x, y, w, h, r);
+    if (memcmp(img[0], img[1], sizeof(img[0])) != 0) {
+      if (err < 5) {
+        printf("refdraw: rbox %d,%d %dx%d r=%d differs\n", x, y, w, h, r);
+      }
+      err++;
+    }
+  }
+
+  return err;
+}
+
+/////////////////////////////////////////////////
+
+int main(void)
+{
+  ucg_t   ucg;
+  uint8_t rotation;
+  long    err = 0, e;
+
+  srand(1);
+  for (rotation = 0; rotation < 2; rotation++) {
+    memset(&ucg, 0, sizeof(ucg));
+    ucg_Init(&ucg, dev_mark, ucg_ext_none, (ucg_com_fnptr) 0);
+    if (rotation) {
+      ucg_SetRotate90(&ucg);
+    }
+    ucg_SetColor(&ucg, 0, 255, 255, 255);
+
+    e = check_lines(&ucg);
+    printf("refdraw: %3d degree, %d lines, %ld differ\n", rotation * 90, REF_ROUNDS, e);
+    err += e;
+    e = check_discs(&ucg);
+    printf("refdraw: %3d degree, %d discs, %ld differ\n", rotation * 90, REF_ROUNDS, e);
+    err += e;
+    e = check_rboxes(&ucg);
+    printf("refdraw: %3d degree, %d rboxes, %ld differ\n", rotation * 90, REF_ROUNDS, e);
+    err += e;
+  }
+  printf("refdraw: %s\n", err ? "FAILED" : "ok");
+
+  return err != 0;
+}
@@ -0,0 +1,372 @@
+/*!
+ *  \file    ucg_host.c
+ *  \brief   Host (Linux) devices for ucglib
+ *
+ *  \details See ucg_host.h
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "ucg_host.h"
+
+ucg_host_stat_t ucg_host_stat;                                  //!< counters
+static ucg_host_trace_t *trace;                                 //!< buffer of the trace, NULL: no trace
+static long trace_size;                                         //!< size of the trace buffer
+static long trace_cnt;                                          //!< number of recorded bytes
+static int panel_w = UCG_HOST_WIDTH;                            //!< width of the panel
+static int panel_h = UCG_HOST_HEIGHT;                           //!< height of the panel
+uint8_t ucg_host_fb[UCG_HOST_MAX_HEIGHT][UCG_HOST_MAX_WIDTH][3];    //!< buffer of ucg_dev_host_fb()
+uint8_t ucg_host_lcd[UCG_HOST_MAX_HEIGHT][UCG_HOST_MAX_WIDTH][3];   //!< emulated RAM of the display
+
+/*!
+ * State of the emulated ST7735
+ */
+static struct {
+  uint8_t   cs;           //!< level of the CS line
+  uint8_t   cd;           //!< level of the CD line, 0: command
+  uint8_t   cmd;          //!< last command
+  uint8_t   argc;         //!< number of arguments of the last command
+  uint8_t   args[4];      //!< arguments of CASET and RASET
+  uint8_t   madctl;       //!< memory access control
+  uint8_t   colmod;       //!< interface pixel format
+  uint16_t  col0, col1;   //!< column window
+  uint16_t  row0, row1;   //!< row window
+  uint16_t  col, row;     //!< current position in the window
+  uint8_t   px[3];        //!< bytes of the current pixel
+  uint8_t   pxi;          //!< number of bytes of the current pixel
+} lcd = { 1, 1, 0, 0, {0}, 0, 0x06 };
+
+/*! \brief  Sets the size of the panel of both devices, call it before ucg_Init()
+ *
+ *  \param  w        width, at most UCG_HOST_MAX_WIDTH
+ *  \param  h        height, at most UCG_HOST_MAX_HEIGHT
+ *
+ *  \return void
+ */
+void ucg_host_SetPanel(int w, int h)
+{
+  panel_w = w < UCG_HOST_MAX_WIDTH ? w : UCG_HOST_MAX_WIDTH;
+  panel_h = h < UCG_HOST_MAX_HEIGHT ? h : UCG_HOST_MAX_HEIGHT;
+}
+
+/*! \brief  Resets all counters
+ *
+ *  \return void
+ */
+void ucg_host_ClearStat(void)
+{
+  memset(&ucg_host_stat, 0, sizeof(ucg_host_stat));
+}
+
+/*! \brief  Starts recording every byte that is sent to the ST7735 with the level of the CD line
+ *
+ *  \param  buf      buffer of the trace
+ *  \param  size     number of entries of the buffer, further bytes are not recorded
+ *
+ *  \return void
+ */
+void ucg_host_StartTrace(ucg_host_trace_t *buf, long size)
+{
+  trace      = buf;
+  trace_size = size;
+  trace_cnt  = 0;
+}
+
+/*! \brief  Stops recording
+ *
+ *  \return number of recorded bytes
+ */
+long ucg_host_StopTrace(void)
+{
+  trace = NULL;
+  return trace_cnt;
+}
+
+/*! \brief  Clears the buffer of the framebuffer device and the emulated ST7735
+ *
+ *  \return void
+ */
+void ucg_host_ClearBuffers(void)
+{
+  memset(ucg_host_fb, 0, sizeof(ucg_host_fb));
+  memset(ucg_host_lcd, 0, sizeof(ucg_host_lcd));
+}
+
+/*! \brief  Compares the buffer of the framebuffer device and the emulated ST7735
+ *
+ *  \return number of pixel that differ
+ */
+long ucg_host_Diff(void)
+{
+  long n = 0;
+  int  x, y;
+
+  for (y = 0; y < panel_h; y++) {
+    for (x = 0; x < panel_w; x++) {
+      if (memcmp(ucg_host_fb[y][x], ucg_host_lcd[y][x], 3) != 0) n++;
+    }
+  }
+
+  return n;
+}
+
+/*! \brief  Expands a RGB565 pixel to 8 bit per color, like the ST7735 does
+ *
+ *  \param  rgb      RGB values, 3 bytes
+ *  \param  rgb565   RGB565 value, 2 bytes (RRRRRGGG GGGBBBBB), may be equal to rgb
+ *
+ *  \return void
+ */
+void ucg_host_Expand565(uint8_t *rgb, const uint8_t *rgb565)
+{
+  uint8_t r, g, b;
+
+  r = rgb565[0] & 0xf8;
+  g = ((rgb565[0] << 5) | ((rgb565[1] >> 3) & 0x1c)) & 0xfc;
+  b = (rgb565[1] << 3) & 0xf8;
+  rgb[0] = r | (r >> 5);
+  rgb[1] = g | (g >> 6);
+  rgb[2] = b | (b >> 5);
+}
+
+/*! \brief  Writes a buffer as binary PPM image
+ *
+ *  \param  name     file name
+ *  \param  img      ucg_host_fb or ucg_host_lcd
+ *
+ *  \return 0 if ok, -1 if the file could not be written
+ */
+int ucg_host_WritePPM(const char *name, uint8_t img[UCG_HOST_MAX_HEIGHT][UCG_HOST_MAX_WIDTH][3])
+{
+  FILE *fp = fopen(name, "wb");
+  int   y;
+
+  if (fp == NULL) return -1;
+
+  fprintf(fp, "P6\n%d %d\n255\n", panel_w, panel_h);
+  for (y = 0; y < panel_h; y++) {
+    fwrite(img[y], 3, panel_w, fp);
+  }
+
+  return fclose(fp) == 0 ? 0 : -1;
+}
+
+/////////////////////////////////////////////////
+
+/*! \brief  The device callback of the framebuffer device.
+ *
+ *          The device uses the generic handlers of ucglib, so every pixel
+ *          is drawn with UCG_MSG_DRAW_PIXEL. Use the rotation and scale devices
+ *          of ucglib on top of this device.
+ *
+ *  \param  ucg      pointer to struct for the display
+ *  \param  msg      number of the message
+ *  \param  data     pointer to data, depends on msg
+ *
+ *  \return 1, or 0 if the message is not supported
+ */
+ucg_int_t ucg_dev_host_fb(ucg_t *ucg, ucg_int_t msg, void *data)
+{
+  switch (msg) {
+    case UCG_MSG_DEV_POWER_UP:
+      return 1;
+    case UCG_MSG_DEV_POWER_DOWN:
+      return 1;
+    case UCG_MSG_GET_DIMENSION:
+      ((ucg_wh_t *) data)->w = panel_w;
+      ((ucg_wh_t *) data)->h = panel_h;
+      return 1;
+    case UCG_MSG_DRAW_PIXEL:
+      if (ucg_clip_is_pixel_visible(ucg)) {
+#if UCG_COLOR_565
+        // store what the ST7735 shows in 16 bit mode
+        ucg_host_Expand565(ucg_host_fb[ucg->arg.pixel.pos.y][ucg->arg.pixel.pos.x], ucg->arg.pixel.rgb.rgb565);
+#else
+        memcpy(ucg_host_fb[ucg->arg.pixel.pos.y][ucg->arg.pixel.pos.x], ucg->arg.pixel.rgb.color, 3);
+#endif
+        ucg_host_stat.pixels++;
+      }
+      return 1;
+    case UCG_MSG_DRAW_L90FX:
+      ucg_handle_l90fx(ucg, ucg_dev_host_fb);
+      return 1;
+#ifdef UCG_MSG_DRAW_L90TC
+    case UCG_MSG_DRAW_L90TC:
+      ucg_handle_l90tc(ucg, ucg_dev_host_fb);
+      return 1;
+#endif
+#ifdef UCG_MSG_DRAW_L90BF
+    case UCG_MSG_DRAW_L90BF:
+      ucg_handle_l90bf(ucg, ucg_dev_host_fb);
+      return 1;
+#endif
+    case UCG_MSG_DRAW_L90SE:
+      ucg_handle_l90se(ucg, ucg_dev_host_fb);
+      return 1;
+  }
+
+  return ucg_dev_default_cb(ucg, msg, data);
+}
+
+/////////////////////////////////////////////////
+
+/*! \brief  Writes the current pixel to the emulated RAM and moves to the next position
+ *
+ *  \return void
+ */
+static void lcd_pixel(void)
+{
+  int x, y;
+
+  if (lcd.madctl & 0x20) {    // MV: exchange row and column
+    x = lcd.row;
+    y = lcd.col;
+  } else {
+    x = lcd.col;
+    y = lcd.row;
+  }
+  if (lcd.madctl & 0x40) x = panel_w - 1 - x;     // MX
+  if (lcd.madctl & 0x80) y = panel_h - 1 - y;     // MY
+
+  if (x >= 0 && x < panel_w && y >= 0 && y < panel_h) {
+    memcpy(ucg_host_lcd[y][x], lcd.px, 3);
+  }
+
+  if (++lcd.col > lcd.col1) {
+    lcd.col = lcd.col0;
+    if (++lcd.row > lcd.row1) lcd.row = lcd.row0;
+  }
+}
+
+/*! \brief  Receives a byte like the ST7735
+ *
+ *  \param  b        the byte
+ *
+ *  \return void
+ */
+static void lcd_byte(uint8_t b)
+{
+  ucg_host_stat.bytes++;
+
+  if (trace != NULL && trace_cnt < trace_size) {
+    trace[trace_cnt].cd = lcd.cd;
+    trace[trace_cnt].b  = b;
+    trace_cnt++;
+  }
+
+  if (lcd.cs) return;          // not selected
+
+  if (lcd.cd == 0) {
+    lcd.cmd  = b;
+    lcd.argc = 0;
+    lcd.pxi  = 0;
+    ucg_host_stat.cmds++;
+    if (b == 0x2c) {           // RAMWR
+      lcd.col = lcd.col0;
+      lcd.row = lcd.row0;
+    }
+    return;
+  }
+
+  switch (lcd.cmd) {
+    case 0x36:                 // MADCTL
+      lcd.madctl = b;
+      break;
+    case 0x3a:                 // COLMOD
+      lcd.colmod = b;
+      break;
+    case 0x2a:                 // CASET
+    case 0x2b:                 // RASET
+      if (lcd.argc < 4) lcd.args[lcd.argc++] = b;
+      if (lcd.argc == 4) {
+        if (lcd.cmd == 0x2a) {
+          lcd.col0 = (lcd.args[0] << 8) | lcd.args[1];
+          lcd.col1 = (lcd.args[2] << 8) | lcd.args[3];
+        } else {
+          lcd.row0 = (lcd.args[0] << 8) | lcd.args[1];
+          lcd.row1 = (lcd.args[2] << 8) | lcd.args[3];
+        }
+      }
+      break;
+    case 0x2c:                 // RAMWR
+      lcd.px[lcd.pxi++] = b;
+      if (lcd.colmod == 0x05 && lcd.pxi == 2) {   // 16 bit per pixel
+        ucg_host_Expand565(lcd.px, lcd.px);
+        lcd_pixel();
+        lcd.pxi = 0;
+      } else if (lcd.pxi == 3) {                  // 18 bit per pixel
+        lcd_pixel();
+        lcd.pxi = 0;
+      }
+      break;
+  }
+}
+
+/*! \brief  Sets the level of the CD line and counts the changes
+ *
+ *  \param  level    new level
+ *
+ *  \return void
+ */
+static void lcd_cd(uint8_t level)
+{
+  if (lcd.cd != level) ucg_host_stat.cd++;
+  lcd.cd = level;
+}
+
+/*! \brief  The communication callback for the ST7735 driver on the host.
+ *
+ *  \param  ucg      pointer to struct for the display
+ *  \param  msg      number of the message (action to be done)
+ *  \param  arg      depends on msg: number of arguments, number of microseconds, ...
+ *  \param  data     pointer to 8-bit data-array with bytes that needs to be send
+ *
+ *  \return 16-bit value, always 1
+ */
+int16_t ucg_com_host(ucg_t *ucg, int16_t msg, uint16_t arg, uint8_t *data)
+{
+  switch (msg) {
+    case UCG_COM_MSG_CHANGE_CS_LINE:
+      if (lcd.cs != (arg != 0)) ucg_host_stat.cs++;
+      lcd.cs = (arg != 0);
+      break;
+    case UCG_COM_MSG_CHANGE_CD_LINE:
+      lcd_cd(arg != 0);
+      break;
+    case UCG_COM_MSG_SEND_BYTE:
+      lcd_byte(arg);
+      break;
+    case UCG_COM_MSG_REPEAT_1_BYTE:
+      while (arg-- > 0) {
+        lcd_byte(data[0]);
+      }
+      break;
+    case UCG_COM_MSG_REPEAT_2_BYTES:
+      while (arg-- > 0) {
+        lcd_byte(data[0]);
+        lcd_byte(data[1]);
+      }
+      break;
+    case UCG_COM_MSG_REPEAT_3_BYTES:
+      while (arg-- > 0) {
+        lcd_byte(data[0]);
+        lcd_byte(data[1]);
+        lcd_byte(data[2]);
+      }
+      break;
+    case UCG_COM_MSG_SEND_STR:
+      while (arg-- > 0) {
+        lcd_byte(*data++);
+      }
+      break;
+    case UCG_COM_MSG_SEND_CD_DATA_SEQUENCE:
+      while (arg-- > 0) {
+        lcd_cd(UCG_COM_CD_SEQ_LEVEL(*data, lcd.cd));
+        data++;
+        lcd_byte(*data++);
+      }
+      break;
+  }
+
+  return 1;
+}
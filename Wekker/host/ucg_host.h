@@ -0,0 +1,67 @@
+/*!
+ *  \file    ucg_host.h
+ *  \brief   Host (Linux) devices for ucglib
+ *
+ *  \details <code>ucg_dev_host_fb()</code> is a device callback that renders into
+ *           the RGB buffer <code>ucg_host_fb</code>, the pixel are counted.
+ *
+ *           <code>ucg_com_host()</code> is a communication callback for the real
+ *           ST7735 driver (<code>ucg_dev_st7735_18x128x160</code>). It counts
+ *           bytes, commands and CS/CD toggles and emulates the RAM of the ST7735
+ *           (MADCTL, CASET, RASET, RAMWR) in <code>ucg_host_lcd</code>. The ILI9341
+ *           (<code>ucg_dev_ili9341_18x240x320</code>) has the same commands.
+ *
+ *           Both buffers have the size of the panel, not rotated: 128 x 160 for the
+ *           ST7735, <code>ucg_host_SetPanel()</code> selects another size up to
+ *           240 x 320. The buffers always have the maximum size, pixel outside of
+ *           the panel are not used.
+ *
+ *           <code>ucg_host_StartTrace()</code> records the bytes for the ST7735 with
+ *           the level of the CD line.
+ */
+#ifndef _UCG_HOST_H
+#define _UCG_HOST_H
+
+#include <stdint.h>
+#include "ucg.h"
+
+#define UCG_HOST_WIDTH    128    //!< default width of the panel, the ST7735
+#define UCG_HOST_HEIGHT   160    //!< default height of the panel, the ST7735
+#define UCG_HOST_MAX_WIDTH  240  //!< maximum width of the panel, the ILI9341
+#define UCG_HOST_MAX_HEIGHT 320  //!< maximum height of the panel, the ILI9341
+
+/*!
+ * Counters of the host devices
+ */
+typedef struct {
+  long pixels;    //!< pixel written by ucg_dev_host_fb()
+  long bytes;     //!< bytes sent to the ST7735
+  long cmds;      //!< commands sent to the ST7735
+  long cs;        //!< changes of the CS line
+  long cd;        //!< changes of the CD line
+} ucg_host_stat_t;
+
+/*!
+ * A byte sent to the ST7735, see ucg_host_StartTrace()
+ */
+typedef struct {
+  uint8_t cd;     //!< level of the CD line, 0: command
+  uint8_t b;      //!< the byte
+} ucg_host_trace_t;
+
+extern ucg_host_stat_t ucg_host_stat;
+extern uint8_t ucg_host_fb[UCG_HOST_MAX_HEIGHT][UCG_HOST_MAX_WIDTH][3];
+extern uint8_t ucg_host_lcd[UCG_HOST_MAX_HEIGHT][UCG_HOST_MAX_WIDTH][3];
+
+ucg_int_t ucg_dev_host_fb(ucg_t *ucg, ucg_int_t msg, void *data);
+int16_t   ucg_com_host(ucg_t *ucg, int16_t msg, uint16_t arg, uint8_t *data);
+
+void ucg_host_SetPanel(int w, int h);
+void ucg_host_ClearStat(void);
+void ucg_host_StartTrace(ucg_host_trace_t *buf, long size);
+long ucg_host_StopTrace(void);
+void ucg_host_ClearBuffers(void);
+long ucg_host_Diff(void);
+void ucg_host_Expand565(uint8_t *rgb, const uint8_t *rgb565);
+int  ucg_host_WritePPM(const char *name, uint8_t img[UCG_HOST_MAX_HEIGHT][UCG_HOST_MAX_WIDTH][3]);
+#endif
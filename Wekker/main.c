@@ -8,6 +8,7 @@
 #include "clock.h"
 #include "csrc/ucg.h"
 #include "ucglib_xmega_hal.h"
+#include "segdigit.h"
 #include "serialF0.h"
 #include "nrf24spiXM2.h"
 #include "nrf24L01.h"
@@ -18,6 +19,11 @@ uint8_t  packet[32];
 volatile uint8_t tgl = 0;
 
 ucg_t	ucg;
+uint8_t	screen = 0;										// 0: display is starting up, 1: first frame, 2: running
+ucg_seg_clock_t	seg_clock;									// seven segment clock, only redraws the changed segments
+ucg_text_slot_t	hum_slot;									// text slots only redraw the changed glyphs
+ucg_text_slot_t	co2_slot;
+ucg_text_slot_t	ppm_slot;
 
 int s = 0;
 int m = 0;
@@ -27,8 +33,8 @@ int am = 0;
 int ah = 0;
 int as = 10;
 
-int px = 7;
-int py = 48;
+int px = 19;									// upper left corner of the clock
+int py = 12;
 
 int f;
 
@@ -77,36 +83,58 @@ int main(void)
 	init_clock();
 	init_klokje();
 	
-	ucg_Init(&ucg, ucg_dev_st7735_18x128x160, ucg_ext_st7735_18,
-		(int (*)(struct _ucg_t *, int,  unsigned int,  unsigned char *)) ucg_comm_xmega);
-	prepare_screen();
+	ucg_SetXmegaDisplay(&ucg, NULL);										// Display connected as defined in ucglib_xmega_hal.h
+	ucg_XmegaInitAsync(&ucg, ucg_dev_st7735_18x128x160, ucg_ext_st7735_18);	// Returns at the first delay of the init sequence
 	while (1)
 	{
-		if (bit_is_set (PORTA.IN, PIN1_bp ))							// If button is pressed allow alarm to be set
+		if (screen == 0 && ucg_XmegaInitPoll(&ucg) == 0)				// Display is ready
+		{
+			prepare_screen();
+			screen = 1;
+		}
+		if (screen == 0)												// Display is starting up, nothing is drawn
+		{
+		}
+		else if (bit_is_set (PORTA.IN, PIN1_bp ))						// If button is pressed allow alarm to be set
 		{			 
 			ucg_SetColor(&ucg, 0, 50, 50, 255);
-			ucg_SetPrintPos(&ucg, px, py);
-			ucg_Print(&ucg,	"%.2d : %.2d", ah, am);
+			ucg_PrintSegClock(&ucg, &seg_clock, ah, am, 1);
 			set_alarm();
 		}
 		else if (bit_is_set (PORTA.IN, PIN2_bp))						// If button is pressed allow time to be set
 		{
 			ucg_SetColor(&ucg, 0, 50, 255, 50);
-			ucg_SetPrintPos(&ucg, px, py);	
-			ucg_Print(&ucg,	"%.2d : %.2d", h, m);
+			ucg_PrintSegClock(&ucg, &seg_clock, h, m, 1);
 			set_time();
 		}
 		else															// If no button is pressed, show time
 		{
 			ucg_SetColor(&ucg, 0, 255, 50, 50);
-			ucg_SetPrintPos(&ucg, px, py);
-			ucg_Print(&ucg,	"%.2d : %.2d", h, m);
+			ucg_PrintSegClock(&ucg, &seg_clock, h, m, (s & 1) == 0);	// colon blinks every second
  			if (tgl == 1)
  			{
 				tgl = 0;
 				print_info();											// Print info from other devices
 			}
 		}
+		if (screen == 1)												// The first frame has been drawn
+		{
+			uint16_t t = ucg_XmegaInitTime();							// Time from boot to the first frame
+			
+			screen = 2;
+			if (t == UCG_XMEGA_INIT_TIME_OVF)
+			{
+				printf("First frame after more than 2097 ms\n");
+			}
+			else
+			{
+				printf("First frame after %u ms\n", t);
+			}
+#if UCG_XMEGA_BENCH
+			ucg_XmegaBench(&ucg);										// Throughput to the display over the serial interface
+			prepare_screen();											// The next frame is drawn completely
+#endif
+		}
 		if (bit_is_set(PORTB.IN, PIN2_bp))								// If switch is on, alarm is activated
 		{
 			PORTB.OUTSET	= PIN7_bm;
@@ -125,6 +153,13 @@ int main(void)
 			PORTB.OUTCLR	= PIN7_bm;
 			TCD0.INTCTRLA  = TC_OVFINTLVL_OFF_gc;
 		}
+#if UCG_XMEGA_STATS
+		ucg_XmegaStatFrame();											// One loop is one frame
+		if (uartF0_getc() == 's')										// Send 's' to print the display traffic
+		{
+			ucg_PrintXmegaStat();
+		}
+#endif
  	}
 }
 
@@ -167,24 +202,28 @@ void geluid(int f)
 void prepare_screen(void)
 {
 	ucg_ClearScreen(&ucg);
-	ucg_SetRotate90(&ucg);
+	ucg_SetHwRotate(&ucg, 1);					// 90 degree, rotated by the ST7735
 	ucg_SetColor(&ucg, 0, 255, 0, 0);
 	ucg_SetFontMode(&ucg, UCG_FONT_MODE_SOLID);
-	ucg_SetFont(&ucg, ucg_font_fur35_hf);
+	
+	ucg_InitSegClock(&seg_clock, px, py, 24, 36, 5, 0);		// 121 x 36 pixels, the size of ucg_font_fur35_hf
+	ucg_InitTextSlot(&hum_slot, 10, 100);
+	ucg_InitTextSlot(&co2_slot, 75, 100);
+	ucg_InitTextSlot(&ppm_slot, 75, 100);
 }
 
 void print_info(void)
 {
+	ucg_int_t w;
+	
 	ucg_SetColor(&ucg, 0, 255, 255, 10);
-	ucg_SetPrintPos(&ucg, 10, 100);
 	ucg_SetFont(&ucg, ucg_font_fur17_hf);
-	ucg_Print(&ucg, "%.3d%%", hum);
+	ucg_PrintSlot(&ucg, &hum_slot, "%.3d%%", hum);
 				
-	ucg_SetPrintPos(&ucg, 75, 100);
-	ucg_Print(&ucg, "%.4d", co2);
+	w = ucg_PrintSlot(&ucg, &co2_slot, "%.4d", co2);
 	ucg_SetFont(&ucg, ucg_font_fur11_hf);
-	ucg_Print(&ucg, "ppm");
-	ucg_SetFont(&ucg, ucg_font_fur35_hf);
+	ucg_MoveTextSlot(&ucg, &ppm_slot, co2_slot.x + w, co2_slot.y);		// unit moves with the width of the value, the old unit is cleared
+	ucg_PrintSlot(&ucg, &ppm_slot, "ppm");
 }
 
 void set_time(void)														// Functie om tijd te zetten
@@ -194,8 +233,7 @@ void set_time(void)														// Functie om tijd te zetten
 		m++;	
  		s = 0;	
 		if (m >= 60) m = 0;
-		ucg_SetPrintPos(&ucg, px, py);
-		ucg_Print(&ucg,	"%.2d : %.2d", h, m);
+		ucg_PrintSegClock(&ucg, &seg_clock, h, m, 1);
 		_delay_ms(10);
 	}
 	if (bit_is_set (PORTB.IN, PIN0_bp))
@@ -203,8 +241,7 @@ void set_time(void)														// Functie om tijd te zetten
 		h++;
  		s = 0;
 		if (h >= 24) h = 0;
-		ucg_SetPrintPos(&ucg, px, py);
-		ucg_Print(&ucg,	"%.2d : %.2d", h, m);
+		ucg_PrintSegClock(&ucg, &seg_clock, h, m, 1);
 		_delay_ms(10);
 	}
 }
@@ -216,8 +253,7 @@ void set_alarm(void)													// Functie om alarm te zetten
 		am++;
 		as = 0;
 		if (am >= 60) am = 0;
-		ucg_SetPrintPos(&ucg, px, py);
-		ucg_Print(&ucg,	"%.2d : %.2d", ah, am);
+		ucg_PrintSegClock(&ucg, &seg_clock, ah, am, 1);
 		_delay_ms(10);
 	}
 	if (bit_is_set (PORTB.IN, PIN0_bp))
@@ -225,8 +261,7 @@ void set_alarm(void)													// Functie om alarm te zetten
 		ah++;
 		as = 0;
 		if (ah >= 24) ah = 0;
-		ucg_SetPrintPos(&ucg, px, py);
-		ucg_Print(&ucg,	"%.2d : %.2d", ah, am);
+		ucg_PrintSegClock(&ucg, &seg_clock, ah, am, 1);
 		_delay_ms(10);
 	}
 }
@@ -326,8 +361,7 @@ uint32_t map(uint32_t x, uint32_t in_min, uint32_t in_max, uint32_t out_min, uin
 
 void deuntje(int f)
 {
-	ucg_SetPrintPos(&ucg, px, py);
-	ucg_Print(&ucg,	"%.2d : %.2d", h, m);
+	ucg_PrintSegClock(&ucg, &seg_clock, h, m, 1);
 	
 	f = 27303;
 	geluid(f);
@@ -0,0 +1,215 @@
+/*!
+ *  \file    segdigit.c
+ *  \brief   Seven segment clock readout for ucglib
+ *
+ *  \details See segdigit.h
+ */
+#include <string.h>
+#include "segdigit.h"
+
+/*!
+ * Segments of the digits 0..9, bit 0 is segment a, bit 6 is segment g
+ */
+static const uint8_t ucg_seg_digit[10] UCG_PROGMEM = {
+  0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F
+};
+
+/*! \brief  Sets the four bytes of a box
+ *
+ *  \param  b        the box: x, y, width, height
+ *  \param  x        x offset
+ *  \param  y        y offset
+ *  \param  w        width
+ *  \param  h        height
+ *
+ *  \return void
+ */
+static void ucg_SetSegBox(uint8_t *b, uint8_t x, uint8_t y, uint8_t w, uint8_t h)
+{
+  b[0] = x;
+  b[1] = y;
+  b[2] = w;
+  b[3] = h;
+}
+
+/*! \brief  Initializes a seven segment clock.
+ *
+ *          The clock has four digits with a colon in the middle, its width is
+ *          4*w + 5*t. The first call of <code>ucg_PrintSegClock()</code> draws all
+ *          segments.
+ *
+ *  \param  clock    pointer to the clock
+ *  \param  x        x-coordinate of the upper left corner
+ *  \param  y        y-coordinate of the upper left corner
+ *  \param  w        width of a digit, at least 3*t
+ *  \param  h        height of a digit, at least 5*t
+ *  \param  t        thickness of the segments, the space between the digits
+ *  \param  round    1: rounded bars (t >= 4), 0: rectangles
+ *
+ *  \return void
+ */
+void ucg_InitSegClock(ucg_seg_clock_t *clock, ucg_int_t x, ucg_int_t y,
+                      uint8_t w, uint8_t h, uint8_t t, uint8_t round)
+{
+  uint8_t mid = (h - t) / 2;      // y offset of segment g
+  uint8_t i;
+
+  clock->x = x;
+  clock->y = y;
+
+  ucg_SetSegBox(clock->box[0], t,   0,       w-2*t, t);            // a
+  ucg_SetSegBox(clock->box[1], w-t, t,       t,     mid-t);        // b
+  ucg_SetSegBox(clock->box[2], w-t, mid+t,   t,     h-mid-2*t);    // c
+  ucg_SetSegBox(clock->box[3], t,   h-t,     w-2*t, t);            // d
+  ucg_SetSegBox(clock->box[4], 0,   mid+t,   t,     h-mid-2*t);    // e
+  ucg_SetSegBox(clock->box[5], 0,   t,       t,     mid-t);        // f
+  ucg_SetSegBox(clock->box[6], t,   mid,     w-2*t, t);            // g
+  ucg_SetSegBox(clock->box[7], 0,   0,       t,     t);            // colon dot
+
+  // ucg_DrawRBox() needs width and height >= 2*r+2
+  clock->r = 0;
+  if ( round && t >= 4 ) clock->r = (t - 2) / 2;
+
+  clock->pos[0] = 0;
+  clock->pos[1] = w + t;
+  clock->pos[2] = 2*w + 4*t;
+  clock->pos[3] = 3*w + 5*t;
+  clock->pos[4] = 2*w + 2*t;        // colon
+  clock->colon_y[0] = h/3 - t/2;
+  clock->colon_y[1] = h - h/3 - t/2 - 1;
+
+  for (i = 0; i < UCG_SEG_DIGITS; i++) {
+    clock->seg[i] = UCG_SEG_UNKNOWN;
+  }
+  clock->colon = UCG_SEG_UNKNOWN;
+}
+
+/*! \brief  Returns the width of a seven segment clock.
+ *
+ *  \param  clock    pointer to the clock
+ *
+ *  \return width in pixels
+ */
+ucg_int_t ucg_GetSegClockWidth(ucg_seg_clock_t *clock)
+{
+  return clock->pos[3] + clock->box[1][0] + clock->box[1][2];
+}
+
+/*! \brief  Draws a box of the clock with the current foreground color.
+ *
+ *  \param  ucg      pointer to struct for the display
+ *  \param  clock    pointer to the clock
+ *  \param  x        x-coordinate of the digit or colon
+ *  \param  y        y-coordinate of the digit or colon
+ *  \param  b        the box: x, y, width, height
+ *
+ *  \return void
+ */
+static void ucg_DrawSegBox(ucg_t *ucg, ucg_seg_clock_t *clock, ucg_int_t x, ucg_int_t y, const uint8_t *b)
+{
+  if ( clock->r > 0 ) {
+    ucg_DrawRBox(ucg, x + b[0], y + b[1], b[2], b[3], clock->r);
+  } else {
+    ucg_DrawBox(ucg, x + b[0], y + b[1], b[2], b[3]);
+  }
+}
+
+/*! \brief  Draws the segments of a digit that changed.
+ *
+ *          Segments that have been switched off are drawn with the background
+ *          color, segments that have been switched on with the foreground color.
+ *
+ *  \param  ucg      pointer to struct for the display
+ *  \param  clock    pointer to the clock
+ *  \param  i        index of the digit
+ *  \param  seg      new segments of the digit
+ *
+ *  \return void
+ */
+static void ucg_DrawSegDigit(ucg_t *ucg, ucg_seg_clock_t *clock, uint8_t i, uint8_t seg)
+{
+  ucg_int_t   x = clock->x + clock->pos[i];
+  uint8_t     on, off, k;
+  ucg_color_t fg;
+
+  if ( clock->seg[i] == UCG_SEG_UNKNOWN ) {
+    on  = seg;
+    off = ~seg & 0x7F;
+  } else {
+    on  = seg & ~clock->seg[i];
+    off = clock->seg[i] & ~seg;
+  }
+
+  if ( off != 0 ) {
+    fg = ucg->arg.rgb[0];
+    ucg->arg.rgb[0] = ucg->arg.rgb[1];
+    for (k = 0; k < 7; k++) {
+      if ( off & (1 << k) ) ucg_DrawSegBox(ucg, clock, x, clock->y, clock->box[k]);
+    }
+    ucg->arg.rgb[0] = fg;
+  }
+  for (k = 0; k < 7; k++) {
+    if ( on & (1 << k) ) ucg_DrawSegBox(ucg, clock, x, clock->y, clock->box[k]);
+  }
+
+  clock->seg[i] = seg;
+}
+
+/*! \brief  Prints the time on a seven segment clock and redraws only the segments that changed.
+ *
+ *          If a color has been changed, all segments and the colon are drawn.
+ *          All boxes are sent to the display in one transaction.
+ *
+ *          For example <code>ucg_PrintSegClock(&ucg, &clock, h, m, s & 1)</code>
+ *          blinks the colon every second and draws the changed segments of the
+ *          last digit when the minute changes.
+ *
+ *  \param  ucg      pointer to struct for the display
+ *  \param  clock    pointer to the clock
+ *  \param  hours    hours, 0..99
+ *  \param  minutes  minutes, 0..99
+ *  \param  colon    1: colon on, 0: colon off
+ *
+ *  \return void
+ */
+void ucg_PrintSegClock(ucg_t *ucg, ucg_seg_clock_t *clock, uint8_t hours, uint8_t minutes, uint8_t colon)
+{
+  uint8_t     digit[UCG_SEG_DIGITS];
+  uint8_t     i, seg, is_batch;
+  ucg_color_t fg;
+
+  if ( memcmp(&clock->fg, &ucg->arg.rgb[0], sizeof(ucg_color_t)) != 0 ||
+       memcmp(&clock->bg, &ucg->arg.rgb[1], sizeof(ucg_color_t)) != 0 ) {
+    for (i = 0; i < UCG_SEG_DIGITS; i++) {
+      clock->seg[i] = UCG_SEG_UNKNOWN;
+    }
+    clock->colon = UCG_SEG_UNKNOWN;
+    clock->fg = ucg->arg.rgb[0];
+    clock->bg = ucg->arg.rgb[1];
+  }
+
+  digit[0] = (hours / 10) % 10;
+  digit[1] = hours % 10;
+  digit[2] = (minutes / 10) % 10;
+  digit[3] = minutes % 10;
+
+  is_batch = ucg_com_BeginBatch(ucg);
+
+  for (i = 0; i < UCG_SEG_DIGITS; i++) {
+    seg = ucg_pgm_read(ucg_seg_digit + digit[i]);
+    if ( seg != clock->seg[i] ) ucg_DrawSegDigit(ucg, clock, i, seg);
+  }
+
+  colon = (colon != 0);
+  if ( colon != clock->colon ) {
+    fg = ucg->arg.rgb[0];
+    if ( !colon ) ucg->arg.rgb[0] = ucg->arg.rgb[1];
+    for (i = 0; i < 2; i++) {
+      ucg_DrawSegBox(ucg, clock, clock->x + clock->pos[4], clock->y + clock->colon_y[i], clock->box[7]);
+    }
+    ucg->arg.rgb[0] = fg;
+    clock->colon = colon;
+  }
+
+  if ( is_batch ) ucg_com_EndBatch(ucg);
+}
@@ -0,0 +1,52 @@
+/*!
+ *  \file    segdigit.h
+ *  \brief   Seven segment clock readout for ucglib
+ *
+ *  \details The digits of a <code>HH : MM</code> readout are drawn as seven bars
+ *           (segments a..g) and a colon of two dots. The bars are filled rectangles or
+ *           rounded boxes of ucglib, their positions are calculated once by
+ *           <code>ucg_InitSegClock()</code> for the size of the digits.
+ *
+ *           <code>ucg_PrintSegClock()</code> remembers the segments that are on the
+ *           display and only draws the segments that changed: a new minute costs a
+ *           few box fills. The colon can be switched on and off for blinking.
+ * \verbatim
+              aaa
+             f   b
+             f   b
+              ggg
+             e   c
+             e   c
+              ddd
+   \endverbatim
+ */
+#ifndef _SEGDIGIT_H
+#define _SEGDIGIT_H
+
+#include "csrc/ucg.h"
+
+#define UCG_SEG_DIGITS      4       //!<  number of digits of the clock
+#define UCG_SEG_UNKNOWN     0xFF    //!<  state of a digit or the colon that has not been drawn
+
+/*!
+ * Struct for a seven segment clock: position, size and the segments on the display
+ */
+typedef struct {
+  ucg_int_t      x;                        //!< x coordinate of the upper left corner
+  ucg_int_t      y;                        //!< y coordinate of the upper left corner
+  uint8_t        box[8][4];                //!< segment a..g and a colon dot: x, y, width, height
+  uint8_t        r;                        //!< radius of the rounded bars, 0: rectangles
+  uint8_t        pos[UCG_SEG_DIGITS+1];    //!< x offset of the digits and the colon
+  uint8_t        colon_y[2];               //!< y offset of the colon dots
+  uint8_t        seg[UCG_SEG_DIGITS];      //!< segments of each digit on the display
+  uint8_t        colon;                    //!< colon on the display
+  ucg_color_t    fg;                       //!< foreground color of the display
+  ucg_color_t    bg;                       //!< background color of the display
+} ucg_seg_clock_t;
+
+void      ucg_InitSegClock(ucg_seg_clock_t *clock, ucg_int_t x, ucg_int_t y,
+                           uint8_t w, uint8_t h, uint8_t t, uint8_t round);
+ucg_int_t ucg_GetSegClockWidth(ucg_seg_clock_t *clock);
+void      ucg_PrintSegClock(ucg_t *ucg, ucg_seg_clock_t *clock, uint8_t hours, uint8_t minutes, uint8_t colon);
+
+#endif // _SEGDIGIT_H
@@ -0,0 +1,336 @@
+/*!
+ *  \file    textslot.c
+ *  \brief   Formatted strings and text slots for ucglib
+ *
+ *  \details See textslot.h
+ */
+#include <string.h>
+#include "textslot.h"
+
+/*! \brief  Writes a formatted string into a buffer. This replaces vsnprintf()
+ *          for the display: no stdio, no heap and no callback per character.
+ *
+ *          Supported are the conversions %d, %i, %u, %x, %X, %c, %s and %%, 
+ *          the flags '-' and '0', a width, a precision (minimum number of digits, 
+ *          e.g. "%.2d", or maximum length of a string) and the length modifier 'l'.
+ *          Floating point numbers are not supported.
+ *
+ *  \param  buf      buffer for the string
+ *  \param  size     size of the buffer, the string is truncated to size-1 characters
+ *  \param  fmt      formatstring with escape sequences
+ *  \param  vl       variables that are printed
+ *
+ *  \return length of the string
+ */
+uint8_t ucg_vformat(char *buf, uint8_t size, const char *fmt, va_list vl)
+{
+  char          digits[3*sizeof(long)];   // digits of a number, least significant first
+  const char   *str;
+  unsigned long u;
+  uint8_t       n = 0, len, zeros, pad, base;
+  uint8_t       left, zero, is_long, prec, width;
+  char          sign, c;
+
+  size--;                       // room for '\0'
+  for ( ; *fmt != '\0'; fmt++) {
+    if ( *fmt != '%' ) {
+      if ( n < size ) buf[n++] = *fmt;
+      continue;
+    }
+
+    left = zero = is_long = 0;
+    width = 0;
+    prec  = 0xFF;               // no precision
+    for (fmt++; *fmt == '-' || *fmt == '0'; fmt++) {
+      if ( *fmt == '-' ) left = 1; else zero = 1;
+    }
+    for ( ; *fmt >= '0' && *fmt <= '9'; fmt++) width = width*10 + *fmt - '0';
+    if ( *fmt == '.' ) {
+      for (prec = 0, fmt++; *fmt >= '0' && *fmt <= '9'; fmt++) prec = prec*10 + *fmt - '0';
+    }
+    if ( *fmt == 'l' ) {
+      is_long = 1;
+      fmt++;
+    }
+
+    sign  = 0;
+    zeros = 0;
+    str   = digits;
+    switch (*fmt) {
+      case 'd':
+      case 'i':
+        if ( is_long ) {
+          long v = va_arg(vl, long);
+          u = v < 0 ? -(unsigned long) v : (unsigned long) v;
+          if ( v < 0 ) sign = '-';
+        } else {
+          int v = va_arg(vl, int);
+          u = v < 0 ? -(unsigned long) v : (unsigned long) v;
+          if ( v < 0 ) sign = '-';
+        }
+        base = 10;
+        break;
+      case 'u':
+      case 'x':
+      case 'X':
+        u = is_long ? va_arg(vl, unsigned long) : va_arg(vl, unsigned int);
+        base = (*fmt == 'u') ? 10 : 16;
+        break;
+      case 'c':
+        digits[0] = (char) va_arg(vl, int);
+        len  = 1;
+        base = 0;
+        break;
+      case 's':
+        str = va_arg(vl, const char *);
+        for (len = 0; str[len] != '\0' && len < prec; len++) ;
+        base = 0;
+        break;
+      case '\0':                // incomplete conversion at the end of the string
+        fmt--;
+        continue;
+      default:                  // "%%" and unknown conversions
+        if ( n < size ) buf[n++] = *fmt;
+        continue;
+    }
+
+    if ( base != 0 ) {
+      // digits in reverse order, no digits for the value 0 with precision 0
+      for (len = 0; u != 0 || (len == 0 && prec != 0); u /= base) {
+        c = u % base;
+        digits[len++] = c < 10 ? '0' + c : (*fmt == 'x' ? 'a' : 'A') + c - 10;
+      }
+      if ( prec != 0xFF && prec > len ) zeros = prec - len;
+      if ( prec == 0xFF && zero && !left && width > len + (sign != 0) ) {
+        zeros = width - len - (sign != 0);
+      }
+    }
+
+    pad = len + zeros + (sign != 0);
+    pad = width > pad ? width - pad : 0;
+    if ( !left ) {
+      for ( ; pad > 0; pad--) if ( n < size ) buf[n++] = ' ';
+    }
+    if ( sign && n < size ) buf[n++] = sign;
+    for ( ; zeros > 0; zeros--) if ( n < size ) buf[n++] = '0';
+    while ( len > 0 ) {
+      len--;
+      if ( n < size ) buf[n++] = (base != 0) ? str[len] : *str++;
+    }
+    for ( ; pad > 0; pad--) if ( n < size ) buf[n++] = ' ';
+  }
+  buf[n] = '\0';
+
+  return n;
+}
+
+/*! \brief  Initializes a text slot at a fixed position.
+ *
+ *          A text slot remembers the last string that has been printed at its position.
+ *          The first call of <code>ucg_PrintSlot()</code> draws the complete string.
+ *
+ *  \param  slot     pointer to the text slot
+ *  \param  x        x-coordinate of the position
+ *  \param  y        y-coordinate of the position
+ *
+ *  \return void
+ */
+void ucg_InitTextSlot(ucg_text_slot_t *slot, ucg_int_t x, ucg_int_t y)
+{
+  slot->x       = x;
+  slot->y       = y;
+  slot->font    = NULL;
+  slot->text[0] = '\0';
+}
+
+/*! \brief  Clears a box with the background color.
+ *
+ *  \param  ucg      pointer to struct for the display
+ *  \param  x        x-coordinate of the left side
+ *  \param  y        y-coordinate of the top
+ *  \param  w        width, nothing is drawn if w <= 0
+ *  \param  h        height, nothing is drawn if h <= 0
+ *
+ *  \return void
+ */
+static void ucg_ClearSlotBox(ucg_t *ucg, ucg_int_t x, ucg_int_t y, ucg_int_t w, ucg_int_t h)
+{
+  ucg_color_t fg;
+
+  if (w <= 0 || h <= 0) return;
+
+  fg  = ucg->arg.rgb[0];
+  ucg->arg.rgb[0] = ucg->arg.rgb[1];
+  ucg_DrawBox(ucg, x, y, w, h);
+  ucg->arg.rgb[0] = fg;
+}
+
+/*! \brief  Returns the top of the text cells of a slot: the top of the highest glyph of the font.
+ *
+ *  \param  ucg      pointer to struct for the display
+ *  \param  slot     pointer to the text slot
+ *
+ *  \return y-coordinate of the top
+ */
+static ucg_int_t ucg_GetSlotTop(ucg_t *ucg, ucg_text_slot_t *slot)
+{
+  return slot->y + ucg->font_calc_vref(ucg) - ucg->font_info.max_char_height - ucg->font_info.y_offset;
+}
+
+/*! \brief  Clears a part of the text cells with the background color, the full height of the font.
+ *
+ *  \param  ucg      pointer to struct for the display
+ *  \param  slot     pointer to the text slot
+ *  \param  x        x-coordinate of the left side
+ *  \param  w        width, nothing is drawn if w <= 0
+ *
+ *  \return void
+ */
+static void ucg_ClearSlotCell(ucg_t *ucg, ucg_text_slot_t *slot, ucg_int_t x, ucg_int_t w)
+{
+  ucg_ClearSlotBox(ucg, x, ucg_GetSlotTop(ucg, slot), w, ucg->font_info.max_char_height);
+}
+
+/*! \brief  Draws a glyph of a text slot and clears the rest of its cell.
+ *
+ *          The glyph box is drawn in the solid font mode. The cell around it, the
+ *          delta x of the glyph and the height of the font, is cleared, so fonts
+ *          with glyphs of different heights (e.g. the _tr fonts) can be used.
+ *
+ *  \param  ucg      pointer to struct for the display
+ *  \param  slot     pointer to the text slot
+ *  \param  x        x-coordinate of the cell
+ *  \param  dx       delta x of the glyph
+ *  \param  c        the glyph
+ *
+ *  \return void
+ */
+static void ucg_DrawSlotGlyph(ucg_t *ucg, ucg_text_slot_t *slot, ucg_int_t x, ucg_int_t dx, char c)
+{
+  ucg_font_decode_t *g = &ucg->font_decode;
+  ucg_int_t top, bottom;
+
+  if ( ucg_DrawGlyph(ucg, x, slot->y, 0, c) == 0 ) return;    // not in the font, g is not valid
+  if ( g->glyph_width > 0 && g->glyph_height > 0 ) {
+    top    = ucg_GetSlotTop(ucg, slot);
+    bottom = top + ucg->font_info.max_char_height;
+    ucg_ClearSlotCell(ucg, slot, x, g->target_x - x);
+    ucg_ClearSlotCell(ucg, slot, g->target_x + g->glyph_width, x + dx - g->target_x - g->glyph_width);
+    ucg_ClearSlotBox(ucg, g->target_x, top, g->glyph_width, g->target_y - top);
+    ucg_ClearSlotBox(ucg, g->target_x, g->target_y + g->glyph_height, g->glyph_width,
+                     bottom - g->target_y - g->glyph_height);
+  } else {
+    ucg_ClearSlotCell(ucg, slot, x, dx);
+  }
+}
+
+/*! \brief  Moves a text slot to another position.
+ *
+ *          Use this for a string that follows another string of variable width,
+ *          e.g. a unit behind a value: print the value, then move the slot of the
+ *          unit to the end of the value and print the unit. The old string is
+ *          cleared with the background color, except the part on the left of the
+ *          new position on the same line, which the value in front of it has already
+ *          drawn over. The next call of <code>ucg_PrintSlot()</code> draws the
+ *          complete string. If the font has been changed since the last string,
+ *          the old string is not cleared.
+ *
+ *  \param  ucg      pointer to struct for the display
+ *  \param  slot     pointer to the text slot
+ *  \param  x        x-coordinate of the new position
+ *  \param  y        y-coordinate of the new position
+ *
+ *  \return void
+ */
+void ucg_MoveTextSlot(ucg_t *ucg, ucg_text_slot_t *slot, ucg_int_t x, ucg_int_t y)
+{
+  ucg_int_t left, right;
+  uint8_t   i;
+
+  if ( slot->x == x && slot->y == y ) return;
+
+  if ( slot->font == ucg->font ) {
+    right = slot->x;
+    for (i = 0; slot->text[i] != '\0'; i++) {
+      right += ucg_GetGlyphWidth(ucg, slot->text[i]);
+    }
+    left = ( slot->y == y && x > slot->x ) ? x : slot->x;
+    ucg_ClearSlotCell(ucg, slot, left, right - left);
+  }
+  ucg_InitTextSlot(slot, x, y);
+}
+
+/*! \brief  Put a formatted string in a text slot and redraw only the glyphs that changed.
+ *
+ *          The string is compared with the string of the previous call. A glyph is
+ *          only drawn if it differs from the old glyph at the same index or if
+ *          its position has been shifted by a glyph with another width in front of it.
+ *          If the font or a color has been changed, the complete string is drawn.
+ *          A remaining part of a longer old string is cleared with the background color,
+ *          except after a change of the font: the old string is not known anymore.
+ *
+ *          For example <code>ucg_PrintSlot(&ucg, &slot, "%.2d : %.2d", h, m)</code>
+ *          sends only the last digit to the display when the minute changes and
+ *          nothing at all when the time is unchanged.
+ *
+ *          Text slots use the solid font mode and print direction 0. Each glyph
+ *          must lie within its delta x and within the height of the font, which is
+ *          true for the fonts of ucglib. The cell of a glyph is cleared around it.
+ *
+ *  \param  ucg      pointer to struct for the display
+ *  \param  slot     pointer to the text slot
+ *  \param  fmt      formatstring with escape sequences
+ *  \param  ...      variables that are printed
+ *
+ *  \return width of the string in pixels
+ */
+ucg_int_t ucg_PrintSlot(ucg_t *ucg, ucg_text_slot_t *slot, char *fmt, ...)
+{
+  va_list   vl;
+  char      text[UCG_SLOT_LEN];
+  uint8_t   all, old_end, i;
+  ucg_int_t x, old_x, dx, old_dx;
+
+  va_start(vl, fmt);
+  ucg_vformat(text, sizeof(text), fmt, vl);
+  va_end(vl);
+
+  all = ( slot->font != ucg->font ) ||
+        ( memcmp(&slot->fg, &ucg->arg.rgb[0], sizeof(ucg_color_t)) != 0 ) ||
+        ( memcmp(&slot->bg, &ucg->arg.rgb[1], sizeof(ucg_color_t)) != 0 );
+
+  x       = slot->x;
+  old_x   = slot->x;
+  old_end = ( slot->font != ucg->font );   // the widths of the old string are known in its own font only
+  for (i=0; text[i] != '\0'; i++) {
+    dx     = ucg_GetGlyphWidth(ucg, text[i]);
+    old_dx = 0;
+    if ( !old_end ) {
+      if ( slot->text[i] == '\0' ) {
+        old_end = 1;
+      } else {
+        old_dx = ucg_GetGlyphWidth(ucg, slot->text[i]);
+      }
+    }
+    if ( all || old_end || text[i] != slot->text[i] || x != old_x ) {
+      ucg_DrawSlotGlyph(ucg, slot, x, dx, text[i]);
+    }
+    x     += dx;
+    old_x += old_dx;
+  }
+
+  if ( !old_end ) {
+    // clear the tail of a longer old string
+    for ( ; slot->text[i] != '\0'; i++) {
+      old_x += ucg_GetGlyphWidth(ucg, slot->text[i]);
+    }
+    ucg_ClearSlotCell(ucg, slot, x, old_x - x);
+  }
+
+  memcpy(slot->text, text, sizeof(text));
+  slot->font = ucg->font;
+  slot->fg   = ucg->arg.rgb[0];
+  slot->bg   = ucg->arg.rgb[1];
+
+  return x - slot->x;
+}
@@ -0,0 +1,43 @@
+/*!
+ *  \file    textslot.h
+ *  \brief   Formatted strings and text slots for ucglib
+ *
+ *  \details <code>ucg_vformat()</code> formats a string like vsnprintf() without
+ *           stdio and heap, it is used by <code>ucg_Print()</code> of the HAL and by
+ *           the text slots.
+ *
+ *           A text slot is a string at a fixed position. <code>ucg_PrintSlot()</code>
+ *           remembers the string that is on the display and only draws the glyphs
+ *           that changed. A slot that follows the width of another string is moved
+ *           with <code>ucg_MoveTextSlot()</code>, which clears the old string.
+ *
+ *           Nothing in here depends on the Xmega, the host benchmark compares the
+ *           text slots with a complete redraw.
+ */
+#ifndef _TEXTSLOT_H
+#define _TEXTSLOT_H
+
+#include <stdarg.h>
+#include "csrc/ucg.h"
+
+#define UCG_SLOT_LEN        16      //!<  maximum length of the string of a text slot, including '\0'
+
+/*!
+ * Struct for a text slot: a string at a fixed position that only redraws the changed glyphs
+ */
+typedef struct {
+  ucg_int_t      x;                          //!< x coordinate of the position
+  ucg_int_t      y;                          //!< y coordinate of the position
+  const unsigned char *font;                 //!< font of the last string, NULL if nothing has been drawn
+  ucg_color_t    fg;                         //!< foreground color of the last string
+  ucg_color_t    bg;                         //!< background color of the last string
+  char           text[UCG_SLOT_LEN];         //!< last string
+} ucg_text_slot_t;
+
+uint8_t   ucg_vformat(char *buf, uint8_t size, const char *fmt, va_list vl);
+
+void      ucg_InitTextSlot(ucg_text_slot_t *slot, ucg_int_t x, ucg_int_t y);
+void      ucg_MoveTextSlot(ucg_t *ucg, ucg_text_slot_t *slot, ucg_int_t x, ucg_int_t y);
+ucg_int_t ucg_PrintSlot(ucg_t *ucg, ucg_text_slot_t *slot, char *fmt, ...);
+
+#endif // _TEXTSLOT_H
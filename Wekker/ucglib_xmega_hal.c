@@ -10,7 +10,7 @@
  *           <a href"https://github.com/olikraus/ucglib/wiki/hal">instructions</a> of Oli Kraus.
  *
  *           This file contains a callback function <code>ucg_com_xmega_bb()</code> that handles the
- *           communication with the Xmega using SPI or bit banging.
+ *           communication with the Xmega using SPI, a USART in Master SPI mode or bit banging.
  *           The Arduino/C++ implementation of ucglib contains extra printing facilities.
  *           This file contains a bunch of functions that implements the same facilities.
  *           So you can use <code>ucg_SetPrintPos()</code>, <code>ucg_SetPrintDir()</code> 
@@ -24,16 +24,22 @@
  *            void  *xmega_hook;   // added pointer for print hook
  *            #endif \endverbatim
  *           or uses the ucg.h of the HAL package in stead
+ *
+ *           The same hook points to the connection of the display, a struct <code>ucg_xmega_t</code>
+ *           with the interface, the pins and the DMA channel. The callback has no global state,
+ *           so more displays can be connected to one Xmega, see ucglib_xmega_hal.h.
  */
 
-#define F_CPU 320000000UL                 //!< System clock is 32 MHz
+#define F_CPU 32000000UL                  //!< System clock is 32 MHz
 
 #include <avr/io.h>
 #include <util/delay.h>
+#include <util/delay_basic.h>
+#include <avr/interrupt.h>
 #include "csrc/ucg.h"
 #include <stdio.h>
-#include <stdlib.h>
 #include <stdarg.h>
+#include <string.h>
 #include "ucglib_xmega_hal.h"
 
 #ifndef DOXYGEN_SKIP
@@ -52,6 +58,21 @@
   #define UCG_XMEGA_CD_bm         (1 << UCG_XMEGA_BB_CD_bp)            
   #define UCG_XMEGA_BLK_bm        (1 << UCG_XMEGA_BB_BLK_bp)           
   #define UCG_XMEGA_BLK_bp        UCG_XMEGA_BB_BLK_bp           
+#elif UCG_XMEGA_USE==UCG_XMEGA_USING_USART
+  #define UCG_XMEGA_SCK_PORT      UCG_XMEGA_USART_PORT
+  #define UCG_XMEGA_SDA_PORT      UCG_XMEGA_USART_PORT
+  #define UCG_XMEGA_CS_PORT       UCG_XMEGA_SPI_SS_PORT   
+  #define UCG_XMEGA_RESET_PORT    UCG_XMEGA_SPI_RESET_PORT
+  #define UCG_XMEGA_CD_PORT       UCG_XMEGA_SPI_CD_PORT   
+  #define UCG_XMEGA_BLK_PORT      UCG_XMEGA_SPI_BLK_PORT
+
+  #define UCG_XMEGA_SCK_bm        (1 << UCG_XMEGA_USART_XCK_bp)
+  #define UCG_XMEGA_SDA_bm        (1 << UCG_XMEGA_USART_TXD_bp)
+  #define UCG_XMEGA_CS_bm         (1 << UCG_XMEGA_SPI_SS_bp)  
+  #define UCG_XMEGA_RESET_bm      (1 << UCG_XMEGA_SPI_RESET_bp)          
+  #define UCG_XMEGA_CD_bm         (1 << UCG_XMEGA_SPI_CD_bp)            
+  #define UCG_XMEGA_BLK_bm        (1 << UCG_XMEGA_SPI_BLK_bp)           
+  #define UCG_XMEGA_BLK_bp        UCG_XMEGA_SPI_BLK_bp           
 #else // using SPI interface
   #define UCG_XMEGA_SCK_PORT      UCG_XMEGA_SPI_SCK_PORT  
   #define UCG_XMEGA_SDA_PORT      UCG_XMEGA_SPI_MOSI_PORT 
@@ -72,93 +93,598 @@
 #endif
 #endif
 
+#if (UCG_XMEGA_USE==UCG_XMEGA_USING_BB)&&UCG_XMEGA_BB_VPORT
+  #define UCG_XMEGA_VPORT_USE     1
+#else
+  #define UCG_XMEGA_VPORT_USE     0
+#endif
+
+#if UCG_XMEGA_VPORT_USE
+#ifndef DOXYGEN_SKIP
+  #if UCG_XMEGA_BB_VPORT_NUM==0
+    #define UCG_XMEGA_VPORT       VPORT0
+    #define UCG_XMEGA_VPCTRL      PORTCFG.VPCTRLA
+    #define UCG_XMEGA_VPMAP_gp    0
+  #elif UCG_XMEGA_BB_VPORT_NUM==1
+    #define UCG_XMEGA_VPORT       VPORT1
+    #define UCG_XMEGA_VPCTRL      PORTCFG.VPCTRLA
+    #define UCG_XMEGA_VPMAP_gp    4
+  #elif UCG_XMEGA_BB_VPORT_NUM==2
+    #define UCG_XMEGA_VPORT       VPORT2
+    #define UCG_XMEGA_VPCTRL      PORTCFG.VPCTRLB
+    #define UCG_XMEGA_VPMAP_gp    0
+  #elif UCG_XMEGA_BB_VPORT_NUM==3
+    #define UCG_XMEGA_VPORT       VPORT3
+    #define UCG_XMEGA_VPCTRL      PORTCFG.VPCTRLB
+    #define UCG_XMEGA_VPMAP_gp    4
+  #else
+    #error UCG_XMEGA_BB_VPORT_NUM must be 0, 1, 2 or 3
+  #endif
+
+  // one bit: SDA, SCK high, SCK low; sbi and cbi take one clock cycle each
+  #define UCG_XMEGA_VPORT_BIT(data, bm)                                     \
+    if ((data) & (bm)) UCG_XMEGA_VPORT.OUT |=  UCG_XMEGA_SDA_bm;            \
+    else               UCG_XMEGA_VPORT.OUT &= ~UCG_XMEGA_SDA_bm;            \
+    UCG_XMEGA_VPORT.OUT |=  UCG_XMEGA_SCK_bm;                               \
+    UCG_XMEGA_VPORT.OUT &= ~UCG_XMEGA_SCK_bm
+
+  #define UCG_XMEGA_VPORT_CLOCK()                                           \
+    UCG_XMEGA_VPORT.OUT |=  UCG_XMEGA_SCK_bm;                               \
+    UCG_XMEGA_VPORT.OUT &= ~UCG_XMEGA_SCK_bm
+#endif
+#endif
+
 #if (UCG_XMEGA_USE==UCG_XMEGA_USING_BB)&&(UCG_XMEGA_BLK==UCG_XMEGA_BLK_EXTERN)
   #warning if display is connect directly to Xmega, use UCG_XMEGA_BLK_DISABLED in stead of UCG_XMEGA_BLK_EXTERN to disable the input pin
 #endif
 
+#if (UCG_XMEGA_USE==UCG_XMEGA_USING_BB)&&UCG_XMEGA_DMA
+  #error DMA is only possible using SPI or USART, set UCG_XMEGA_DMA to 0
+#endif
+
+/*!
+ * Connection of the display defined by the macros of ucglib_xmega_hal.h. It is selected by
+ * <code>ucg_SetXmegaDisplay(&ucg, NULL)</code>.
+ */
+static ucg_xmega_t xmega_display = {
+  #if UCG_XMEGA_USE==UCG_XMEGA_USING_SPI
+  .spi         = &UCG_XMEGA_INTERFACE,
+  #elif UCG_XMEGA_USE==UCG_XMEGA_USING_USART
+  .usart       = &UCG_XMEGA_USART,
+  #endif
+  .sck_port    = &UCG_XMEGA_SCK_PORT,
+  .sck_bm      = UCG_XMEGA_SCK_bm,
+  .sda_port    = &UCG_XMEGA_SDA_PORT,
+  .sda_bm      = UCG_XMEGA_SDA_bm,
+  .cs_port     = &UCG_XMEGA_CS_PORT,
+  .cs_bm       = UCG_XMEGA_CS_bm,
+  .reset_port  = &UCG_XMEGA_RESET_PORT,
+  .reset_bm    = UCG_XMEGA_RESET_bm,
+  .cd_port     = &UCG_XMEGA_CD_PORT,
+  .cd_bm       = UCG_XMEGA_CD_bm,
+  .blk_port    = &UCG_XMEGA_BLK_PORT,
+  .blk_bp      = UCG_XMEGA_BLK_bp,
+  .blk         = UCG_XMEGA_BLK,
+  #if UCG_XMEGA_DMA
+  .dma_ch      = &UCG_XMEGA_DMA_CH,
+  .dma_trigsrc = UCG_XMEGA_DMA_TRIGSRC,
+  #endif
+};
+
 /*! \brief  Initialization of the communication 
+ *
+ *  \param  d        pointer to the connection of the display
  *
  *  \return void
  */
-static void xmega_init(void)
+static void xmega_init(ucg_xmega_t *d)
 {
-  UCG_XMEGA_RESET_PORT.DIRSET = UCG_XMEGA_RESET_bm;
-  UCG_XMEGA_CD_PORT.DIRSET    = UCG_XMEGA_CD_bm;
-  #if UCG_XMEGA_BLK==UCG_XMEGA_BLK_DISABLED
-    *( (register8_t *) ( &(UCG_XMEGA_BLK_PORT.PIN0CTRL) + UCG_XMEGA_BLK_bp) ) = PORT_ISC_INPUT_DISABLE_gc;
-  #elif UCG_XMEGA_BLK==UCG_XMEGA_BLK_CONNECT 
-      UCG_XMEGA_BLK_PORT.DIRSET   = UCG_XMEGA_BLK_bm;
-      UCG_XMEGA_BLK_PORT.OUTSET   = UCG_XMEGA_BLK_bm;
+  d->reset_port->DIRSET = d->reset_bm;
+  d->cd_port->DIRSET    = d->cd_bm;
+  if (d->blk == UCG_XMEGA_BLK_DISABLED) {
+    *( &(d->blk_port->PIN0CTRL) + d->blk_bp ) = PORT_ISC_INPUT_DISABLE_gc;
+  } else if (d->blk == UCG_XMEGA_BLK_CONNECT) {
+    d->blk_port->DIRSET = (1 << d->blk_bp);
+    d->blk_port->OUTSET = (1 << d->blk_bp);
+  }
+
+  d->sck_port->DIRSET   = d->sck_bm;
+  d->sda_port->DIRSET   = d->sda_bm;
+  d->cs_port->DIRSET    = d->cs_bm;
+  d->cs_port->OUTSET    = d->cs_bm;
+
+  #if UCG_XMEGA_VPORT_USE
+    if (d == &xmega_display) {
+      // number of the port: PORTA is 0, PORTB is 1, ...
+      UCG_XMEGA_VPCTRL = (UCG_XMEGA_VPCTRL & ~(0x0F << UCG_XMEGA_VPMAP_gp)) |
+                         ((((uint16_t) &UCG_XMEGA_SCK_PORT - (uint16_t) &PORTA) / sizeof(PORT_t)) << UCG_XMEGA_VPMAP_gp);
+    }
   #endif
-      
-  UCG_XMEGA_SCK_PORT.DIRSET   = UCG_XMEGA_SCK_bm;
-  UCG_XMEGA_SDA_PORT.DIRSET   = UCG_XMEGA_SDA_bm;
-  UCG_XMEGA_CS_PORT.DIRSET    = UCG_XMEGA_CS_bm;
-  UCG_XMEGA_CS_PORT.OUTSET    = UCG_XMEGA_CS_bm;
 
   #if UCG_XMEGA_USE==UCG_XMEGA_USING_SPI
-    UCG_XMEGA_MISO_PORT.DIRCLR  = UCG_XMEGA_MISO_bm;
-    UCG_XMEGA_INTERFACE.CTRL    =  SPI_ENABLE_bm |  // enable SPI
-                                 SPI_MASTER_bm |  // master mode
-                              // SPI_CLK2X_bm  |  // no double clock speed
-                              // SPI_DORD_bm   |  // MSB first
-                                 SPI_MODE_0_gc |  // SPI mode 0
-                                 SPI_PRESCALER_DIV4_gc;  // prescaling 4
+    d->sck_port->DIRCLR = PIN6_bm;    // MISO, the pins of an SPI interface are fixed: SS, MOSI, MISO, SCK = 4..7
+    d->spi->CTRL        =  SPI_ENABLE_bm |  // enable SPI
+                           SPI_MASTER_bm |  // master mode
+                           (UCG_XMEGA_SPI_CLK2X ? SPI_CLK2X_bm : 0) |  // double clock speed
+                        // SPI_DORD_bm   |  // MSB first
+                           SPI_MODE_0_gc |  // SPI mode 0
+                           UCG_XMEGA_SPI_PRESCALER;  // prescaling
+  #elif UCG_XMEGA_USE==UCG_XMEGA_USING_USART
+    d->sck_port->OUTCLR = d->sck_bm;  // XCK low when idle: SPI mode 0
+    d->usart->BAUDCTRLA = UCG_XMEGA_USART_BSEL;
+    d->usart->BAUDCTRLB = 0;
+    d->usart->CTRLC     = USART_CMODE_MSPI_gc;  // Master SPI mode 0, MSB first
+    d->usart->CTRLB     = USART_TXEN_bm;        // only the transmitter
+    d->usart_busy       = 0;
+  #endif
+  #if UCG_XMEGA_DMA
+    d->dma_busy = 0;
+    DMA.CTRL |= DMA_ENABLE_bm;
   #endif
 }
 
-/*! \brief  Disable communication
-*
-*  \return void
-*/
-static void xmega_disable(void)
+#if UCG_XMEGA_USE==UCG_XMEGA_USING_USART
+/*! \brief  Waits until the USART has sent the last byte
+ *
+ *          The data register of the USART is double buffered: a byte is written
+ *          while the previous byte is shifted out, so the bytes are sent back to back.
+ *          The transmit complete flag is set when the shift register is empty and
+ *          no byte is waiting in the data register, as the manual prescribes for
+ *          Master SPI mode. It has been cleared when the last byte was written.
+ *
+ *  \param  d        pointer to the connection of the display
+ *
+ *  \return void
+ */
+static void xmega_usart_flush(ucg_xmega_t *d)
+{
+  if (!d->usart_busy) return;
+
+  while (!(d->usart->STATUS & USART_TXCIF_bm));
+  d->usart_busy = 0;
+}
+
+/*! \brief  Writes a byte to the data register of the USART and returns while it is sent
+ *
+ *          The transmit complete flag is cleared right after the write: it can not
+ *          be set before this byte has been sent. Interrupts are disabled in between,
+ *          an interrupt routine longer than a frame would otherwise clear the flag
+ *          of this byte.
+ *
+ *  \param  d        pointer to the connection of the display
+ *  \param  data     the byte
+ *
+ *  \return void
+ */
+static inline void xmega_usart_put(ucg_xmega_t *d, uint8_t data)
+{
+  uint8_t sreg;
+
+  while (!(d->usart->STATUS & USART_DREIF_bm));
+  sreg = SREG;
+  cli();
+  d->usart->DATA   = data;
+  d->usart->STATUS = USART_TXCIF_bm;
+  SREG = sreg;
+  d->usart_busy    = 1;
+}
+#endif
+
+#if UCG_XMEGA_DMA
+/*! \brief  Waits until the last DMA transfer has been sent completely
+ *
+ *          The DMA channel is ready if the last byte has been written to the
+ *          data register. The byte has been sent if the interrupt flag of the SPI
+ *          interface is set. A USART may still be sending the last bytes, see
+ *          <code>xmega_usart_flush()</code>.
+ *
+ *  \param  d        pointer to the connection of the display
+ *
+ *  \return void
+ */
+static void xmega_dma_wait(ucg_xmega_t *d)
 {
+  if (!d->dma_busy) return;
+
+  while (d->dma_ch->CTRLB & (DMA_CH_CHBUSY_bm | DMA_CH_CHPEND_bm));
+#if UCG_XMEGA_USE==UCG_XMEGA_USING_USART
+  d->usart_busy = 1;
+#else
+  while (!(d->spi->STATUS & SPI_IF_bm));
+#endif
+  d->dma_ch->CTRLB = DMA_CH_TRNIF_bm | DMA_CH_ERRIF_bm;
+  d->dma_busy = 0;
+}
+
+/*! \brief  Starts a DMA transfer to the SPI interface or the USART and returns immediately
+ *
+ *          Using SPI the first byte is requested by software, every next byte is requested
+ *          by the interrupt flag of the SPI interface. Using USART every byte is requested
+ *          by the data register empty flag. The DMA refills the data register within a
+ *          frame, so the transmit complete flag is first set after the last byte.
+ *
+ *  \param  d        pointer to the connection of the display
+ *  \param  src      source address
+ *  \param  len      number of bytes of a block
+ *  \param  reps     number of blocks, the source is reloaded after every block
+ *  \param  srcdir   DMA_CH_SRCDIR_INC_gc or DMA_CH_SRCDIR_FIXED_gc
+ *
+ *  \return void
+ */
+static void xmega_dma_start(ucg_xmega_t *d, const uint8_t *src, uint16_t len, uint8_t reps, uint8_t srcdir)
+{
+  DMA_CH_t *ch = d->dma_ch;
+
+  #if UCG_XMEGA_USE==UCG_XMEGA_USING_USART
+    register8_t *dest = &d->usart->DATA;
+  #else
+    register8_t *dest = &d->spi->DATA;
+  #endif
+
+  xmega_dma_wait(d);
   #if UCG_XMEGA_USE==UCG_XMEGA_USING_SPI
-    UCG_XMEGA_INTERFACE.CTRL    = UCG_XMEGA_INTERFACE.CTRL & ~SPI_ENABLE_bm;
+    (void) d->spi->STATUS;              // clear the interrupt flag of the previous byte
+    (void) d->spi->DATA;
+  #else
+    xmega_usart_flush(d);               // the transmit complete flag is set by the last byte of this transfer
+    d->usart->STATUS = USART_TXCIF_bm;
   #endif
-  #if UCG_XMEGA_BLK==UCG_XMEGA_BLK_CONNECT
-    UCG_XMEGA_BLK_PORT.OUTCLR = UCG_XMEGA_BLK_bm;
+
+  ch->SRCADDR0  = (uint8_t) ((uint16_t) src);
+  ch->SRCADDR1  = (uint8_t) ((uint16_t) src >> 8);
+  ch->SRCADDR2  = 0;
+  ch->DESTADDR0 = (uint8_t) ((uint16_t) dest);
+  ch->DESTADDR1 = (uint8_t) ((uint16_t) dest >> 8);
+  ch->DESTADDR2 = 0;
+  ch->ADDRCTRL  = DMA_CH_SRCRELOAD_BLOCK_gc | srcdir |
+                  DMA_CH_DESTRELOAD_NONE_gc | DMA_CH_DESTDIR_FIXED_gc;
+  ch->TRIGSRC   = d->dma_trigsrc;
+  ch->TRFCNT    = len;
+  ch->REPCNT    = reps;
+  ch->CTRLA     = DMA_CH_ENABLE_bm | DMA_CH_SINGLE_bm | DMA_CH_BURSTLEN_1BYTE_gc |
+                  (reps > 1 ? DMA_CH_REPEAT_bm : 0);
+  #if UCG_XMEGA_USE==UCG_XMEGA_USING_SPI
+    ch->CTRLA  |= DMA_CH_TRFREQ_bm;
   #endif
+  d->dma_busy = 1;
 }
 
+/*! \brief  Returns the DMA buffer that is not used by the running transfer
+ *
+ *  \param  d        pointer to the connection of the display
+ *
+ *  \return pointer to the buffer
+ */
+static uint8_t *xmega_dma_get_buf(ucg_xmega_t *d)
+{
+  uint8_t *buf = d->dma_buf[d->dma_next];
+
+  d->dma_next ^= 1;
+
+  return buf;
+}
+#endif
+
+/*! \brief  Disable communication
+ *
+ *  \param  d        pointer to the connection of the display
+ *
+ *  \return void
+ */
+static void xmega_disable(ucg_xmega_t *d)
+{
+  #if UCG_XMEGA_USE==UCG_XMEGA_USING_SPI
+    d->spi->CTRL = d->spi->CTRL & ~SPI_ENABLE_bm;
+  #elif UCG_XMEGA_USE==UCG_XMEGA_USING_USART
+    xmega_usart_flush(d);
+    d->usart->CTRLB = 0;
+  #endif
+  if (d->blk == UCG_XMEGA_BLK_CONNECT) {
+    d->blk_port->OUTCLR = (1 << d->blk_bp);
+  }
+}
+
+#if UCG_XMEGA_VPORT_USE
+/*! \brief  Transfer a byte by bit banging through the virtual port
+ *
+ *          The loop is unrolled and every pin change is a single cycle instruction.
+ *          Only the display connected by the macros of ucglib_xmega_hal.h uses the
+ *          virtual port. SCK and SDA must be on the same port.
+ *
+ *  \param  data     the byte
+ *
+ *  \return void
+ */
+static inline void xmega_vport_byte(uint8_t data)
+{
+  UCG_XMEGA_VPORT_BIT(data, 0x80);
+  UCG_XMEGA_VPORT_BIT(data, 0x40);
+  UCG_XMEGA_VPORT_BIT(data, 0x20);
+  UCG_XMEGA_VPORT_BIT(data, 0x10);
+  UCG_XMEGA_VPORT_BIT(data, 0x08);
+  UCG_XMEGA_VPORT_BIT(data, 0x04);
+  UCG_XMEGA_VPORT_BIT(data, 0x02);
+  UCG_XMEGA_VPORT_BIT(data, 0x01);
+}
+
+/*! \brief  Transfer a byte of which all bits are equal to SDA: only SCK is clocked
+ *
+ *  \return void
+ */
+static inline void xmega_vport_clock8(void)
+{
+  UCG_XMEGA_VPORT_CLOCK();
+  UCG_XMEGA_VPORT_CLOCK();
+  UCG_XMEGA_VPORT_CLOCK();
+  UCG_XMEGA_VPORT_CLOCK();
+  UCG_XMEGA_VPORT_CLOCK();
+  UCG_XMEGA_VPORT_CLOCK();
+  UCG_XMEGA_VPORT_CLOCK();
+  UCG_XMEGA_VPORT_CLOCK();
+}
+
+/*! \brief  Transfer a group of 1, 2 or 3 bytes repeatedly through the virtual port
+ *
+ *          Bytes 0x00 and 0xFF, e.g. black and white, set SDA once and only clock SCK.
+ *          If the group consists of one of these bytes, SDA is set once for all groups.
+ *
+ *  \param  data     pointer to the group of bytes
+ *  \param  size     number of bytes of the group
+ *  \param  cnt      number of groups
+ *
+ *  \return void
+ */
+static void xmega_vport_repeat(uint8_t *data, uint8_t size, uint16_t cnt)
+{
+  uint8_t  i, b;
+  uint32_t n;
+
+  for (i = 1; i < size && data[i] == data[0]; i++) ;
+  if (i == size && (data[0] == 0x00 || data[0] == 0xFF)) {
+    if (data[0]) {
+      UCG_XMEGA_VPORT.OUT |=  UCG_XMEGA_SDA_bm;
+    } else {
+      UCG_XMEGA_VPORT.OUT &= ~UCG_XMEGA_SDA_bm;
+    }
+    for (n = (uint32_t) cnt * size; n > 0; n--) {
+      xmega_vport_clock8();
+    }
+  } else {
+    while (cnt > 0) {
+      for (i = 0; i < size; i++) {
+        b = data[i];
+        if (b == 0x00) {
+          UCG_XMEGA_VPORT.OUT &= ~UCG_XMEGA_SDA_bm;
+          xmega_vport_clock8();
+        } else if (b == 0xFF) {
+          UCG_XMEGA_VPORT.OUT |=  UCG_XMEGA_SDA_bm;
+          xmega_vport_clock8();
+        } else {
+          xmega_vport_byte(b);
+        }
+      }
+      cnt--;
+    }
+  }
+  UCG_XMEGA_VPORT.OUT |= UCG_XMEGA_SDA_bm;
+}
+#endif
+
 /*! \brief  Transfer a byte 
+ *
+ *  \param  d        pointer to the connection of the display
+ *  \param  data     the byte
  *
  *  \return void
  */
-static void xmega_transfer(uint8_t data)
+static void xmega_transfer(ucg_xmega_t *d, uint8_t data)
 {
   #if UCG_XMEGA_USE==UCG_XMEGA_USING_BB
+    #if UCG_XMEGA_VPORT_USE
+      if (d == &xmega_display) {
+        xmega_vport_byte(data);
+        UCG_XMEGA_VPORT.OUT |= UCG_XMEGA_SDA_bm;
+        return;
+      }
+    #endif
+    PORT_t  *sda    = d->sda_port;
+    PORT_t  *sck    = d->sck_port;
+    uint8_t  sda_bm = d->sda_bm;
+    uint8_t  sck_bm = d->sck_bm;
+
     for (uint8_t i=0; i<8; i++) {
       if (data & 0x80) {
-        UCG_XMEGA_SDA_PORT.OUTSET = UCG_XMEGA_SDA_bm; 
+        sda->OUTSET = sda_bm; 
       } else {
-        UCG_XMEGA_SDA_PORT.OUTCLR = UCG_XMEGA_SDA_bm;
+        sda->OUTCLR = sda_bm;
       }
-      UCG_XMEGA_SCK_PORT.OUTSET = UCG_XMEGA_SCK_bm;
-      UCG_XMEGA_SCK_PORT.OUTCLR = UCG_XMEGA_SCK_bm;
+      sck->OUTSET = sck_bm;
+      sck->OUTCLR = sck_bm;
       data <<= 1;
     }
     
-    UCG_XMEGA_SDA_PORT.OUTSET = UCG_XMEGA_SDA_bm;
+    sda->OUTSET = sda_bm;
+  #elif UCG_XMEGA_USE==UCG_XMEGA_USING_USART
+    #if UCG_XMEGA_DMA
+      xmega_dma_wait(d);
+    #endif
+    xmega_usart_put(d, data);
   #else // using SPI interface
-    UCG_XMEGA_INTERFACE.DATA = data;
-    while(!(UCG_XMEGA_INTERFACE.STATUS & (SPI_IF_bm)));
+    #if UCG_XMEGA_DMA
+      xmega_dma_wait(d);
+    #endif
+    d->spi->DATA = data;
+    while(!(d->spi->STATUS & (SPI_IF_bm)));
   #endif
 }
 
-/////////////////////////////////////////////////
+/*! \brief  Transfer a string of bytes
+ *
+ *          With DMA the bytes are copied to a DMA buffer and the function returns
+ *          while the bytes are sent.
+ *
+ *  \param  d        pointer to the connection of the display
+ *  \param  data     pointer to the bytes
+ *  \param  len      number of bytes
+ *
+ *  \return void
+ */
+static void xmega_transfer_str(ucg_xmega_t *d, uint8_t *data, uint16_t len)
+{
+  #if UCG_XMEGA_DMA
+    uint8_t *buf;
+    uint8_t  n;
 
-/*!
- * Struct for compatibility printing facilities with Arduino/C++ version of library 
+    while (len >= UCG_XMEGA_DMA_MIN) {
+      n   = len > UCG_XMEGA_DMA_BUF_SIZE ? UCG_XMEGA_DMA_BUF_SIZE : len;
+      buf = xmega_dma_get_buf(d);
+      memcpy(buf, data, n);             // while the previous buffer is sent
+      xmega_dma_start(d, buf, n, 1, DMA_CH_SRCDIR_INC_gc);
+      data += n;
+      len  -= n;
+    }
+  #endif
+  #if UCG_XMEGA_VPORT_USE
+    if (d == &xmega_display) {
+      while (len > 0) {
+        xmega_vport_byte(*data++);
+        len--;
+      }
+      UCG_XMEGA_VPORT.OUT |= UCG_XMEGA_SDA_bm;
+      return;
+    }
+  #endif
+  while (len > 0) {
+    xmega_transfer(d, *data++);
+    len--;
+  }
+}
+
+/*! \brief  Transfer a group of 1, 2 or 3 bytes repeatedly
+ *
+ *          With DMA the group is copied to a DMA buffer as often as it fits.
+ *          The buffer is sent as a block that is repeated at most 255 times.
+ *          Groups of 1 byte are sent as one block with a fixed source address.
+ *          Bit banging through a virtual port uses <code>xmega_vport_repeat()</code>.
+ *
+ *  \param  d        pointer to the connection of the display
+ *  \param  data     pointer to the group of bytes
+ *  \param  size     number of bytes of the group
+ *  \param  cnt      number of groups
+ *
+ *  \return void
+ */
+static void xmega_transfer_repeat(ucg_xmega_t *d, uint8_t *data, uint8_t size, uint16_t cnt)
+{
+  #if UCG_XMEGA_DMA
+    if ((uint32_t) cnt * size >= UCG_XMEGA_DMA_MIN) {
+      uint8_t *buf = xmega_dma_get_buf(d);
+      uint8_t  k, i;
+      uint16_t blocks;
+      uint8_t  reps;
+
+      if (size == 1) {
+        buf[0] = data[0];
+        xmega_dma_start(d, buf, cnt, 1, DMA_CH_SRCDIR_FIXED_gc);
+        return;
+      }
+      k = UCG_XMEGA_DMA_BUF_SIZE / size;        // groups per block
+      for (i = 0; i < k * size; i++) {
+        buf[i] = data[i % size];
+      }
+      blocks = cnt / k;
+      while (blocks > 0) {
+        reps = blocks > 255 ? 255 : blocks;
+        xmega_dma_start(d, buf, k * size, reps, DMA_CH_SRCDIR_INC_gc);
+        blocks -= reps;
+      }
+      cnt %= k;
+      if (cnt > 0) {
+        xmega_dma_start(d, buf, cnt * size, 1, DMA_CH_SRCDIR_INC_gc);
+      }
+      return;
+    }
+  #endif
+  #if UCG_XMEGA_VPORT_USE
+    if (d == &xmega_display) {
+      xmega_vport_repeat(data, size, cnt);
+      return;
+    }
+  #endif
+  while (cnt > 0) {
+    for (uint8_t i = 0; i < size; i++) {
+      xmega_transfer(d, data[i]);
+    }
+    cnt--;
+  }
+}
+
+/*! \brief  Transfer a sequence of pairs of a CD control byte and a data byte
+ *
+ *          The control byte changes the CD line before the data byte is sent:
+ *          0 keeps the level, 1 sets CD low (command), every other value sets CD high (data).
+ *          UCG_COM_CD_SEQ_LEVEL() decodes it, like ucg_com_host() of the host test.
+ *          The next pair is decoded while the current byte is shifted out. The CD line
+ *          is changed after the previous byte has been sent completely. Using USART
+ *          the data bytes without a change of CD are sent back to back.
+ *
+ *  \param  d        pointer to the connection of the display
+ *  \param  data     pointer to the pairs
+ *  \param  cnt      number of pairs
+ *
+ *  \return void
  */
-typedef struct {      
-  FILE      *fp;      //!< file pointer for printing 
-  ucg_int_t  tx;      //!< current x coordinate of the position
-  ucg_int_t  ty;      //!< current y coordinate of the position
-  uint8_t    tdir;    //!< current printing direction
-} ucg_print_t;           
+static void xmega_transfer_cd_seq(ucg_xmega_t *d, uint8_t *data, uint16_t cnt)
+{
+  uint8_t cd, b;
+  uint8_t level = (d->cd_port->OUT & d->cd_bm) != 0;
+
+  #if UCG_XMEGA_DMA
+    xmega_dma_wait(d);
+  #endif
+  #if UCG_XMEGA_USE==UCG_XMEGA_USING_SPI
+    uint8_t busy = 0;
+  #endif
 
-ucg_t *curr_ucg;    //!< global pointer necessary for the printing facilities 
+  while (cnt > 0) {
+    cd = *data++;
+    b  = *data++;
+    #if UCG_XMEGA_USE==UCG_XMEGA_USING_SPI
+      if (busy) {
+        while(!(d->spi->STATUS & (SPI_IF_bm)));
+      }
+    #endif
+    cd = UCG_COM_CD_SEQ_LEVEL(cd, level);
+    if (cd != level) {
+      #if UCG_XMEGA_USE==UCG_XMEGA_USING_USART
+        xmega_usart_flush(d);
+      #endif
+      if (cd) {
+        d->cd_port->OUTSET = d->cd_bm;
+      } else {
+        d->cd_port->OUTCLR = d->cd_bm;
+      }
+      level = cd;
+    }
+    #if UCG_XMEGA_USE==UCG_XMEGA_USING_SPI
+      d->spi->DATA = b;
+      busy = 1;
+    #elif UCG_XMEGA_USE==UCG_XMEGA_USING_USART
+      xmega_usart_put(d, b);
+    #else
+      xmega_transfer(d, b);
+    #endif
+    cnt--;
+  }
+
+  #if UCG_XMEGA_USE==UCG_XMEGA_USING_SPI
+    if (busy) {
+      while(!(d->spi->STATUS & (SPI_IF_bm)));
+    }
+  #endif
+}
+
+/////////////////////////////////////////////////
 
 /*! \brief  Sets the position for next "print" command.
  *
@@ -170,8 +696,8 @@ ucg_t *curr_ucg;    //!< global pointer necessary for the printing facilities
  */
 void ucg_SetPrintPos(ucg_t *ucg, ucg_int_t x, ucg_int_t y)
 {
-  ((ucg_print_t *)ucg->xmega_hook)->tx = x;
-  ((ucg_print_t *)ucg->xmega_hook)->ty = y;
+  ((ucg_xmega_t *)ucg->xmega_hook)->print.tx = x;
+  ((ucg_xmega_t *)ucg->xmega_hook)->print.ty = y;
 }
 
 /*! \brief  Gets the current position of the 'print cursor'
@@ -184,8 +710,8 @@ void ucg_SetPrintPos(ucg_t *ucg, ucg_int_t x, ucg_int_t y)
  */
 void ucg_GetPrintPos(ucg_t *ucg, ucg_int_t *x, ucg_int_t *y)
 {
-  *x = ((ucg_print_t *)ucg->xmega_hook)->tx;
-  *y = ((ucg_print_t *)ucg->xmega_hook)->ty;
+  *x = ((ucg_xmega_t *)ucg->xmega_hook)->print.tx;
+  *y = ((ucg_xmega_t *)ucg->xmega_hook)->print.ty;
 }
 
 /*! \brief  Sets the direction for next "print" command.
@@ -197,32 +723,7 @@ void ucg_GetPrintPos(ucg_t *ucg, ucg_int_t *x, ucg_int_t *y)
  */
 void ucg_SetPrintDir(ucg_t *ucg, uint8_t dir)
 {
-  ((ucg_print_t *)ucg->xmega_hook)->tdir = dir;
-}
-
-/*! \brief  Put a character to the display at the
- *          current position and in the current direction.
- *
- *  \param  ucg      pointer to struct for the display
- *  \param  dir      the direction
- *
- *  \return void
- */
-static int ucg_Putc(char c, FILE *stream)
-{
-  ucg_int_t delta;
-  ucg_print_t *p = (ucg_print_t *) (curr_ucg->xmega_hook);
-  
-  delta = ucg_DrawGlyph(curr_ucg, p->tx, p->ty, p->tdir, c);
-  
-  switch(p->tdir) {
-    case          0: p->tx += delta; break;
-    case          1: p->ty += delta; break;
-    case          2: p->tx -= delta; break;
-    default: case 3: p->ty -= delta; break;
-  }
-  
-  return 1;
+  ((ucg_xmega_t *)ucg->xmega_hook)->print.tdir = dir;
 }
 
 /*! \brief  Put a formatted string to the display at the
@@ -235,12 +736,17 @@ static int ucg_Putc(char c, FILE *stream)
  *          ucg.print("text ");
  *          ucg.print(x);     // x is an int
  *          ucg.print(" more text ");
- *          ucg.print(y);     // y is a float
+ *          ucg.print(y);     // y is a long
  *          ucg.println(";"); \endverbatim
  *              
  *          The replacement in Xmega style:
  *\verbatim
- *          ucg_Print(&ucg, "text %d more text %f;\n", x, y); \endverbatim
+ *          ucg_Print(&ucg, "text %d more text %ld;", x, y); \endverbatim
+ *
+ *          The string is formatted by <code>ucg_vformat()</code> into a buffer of 
+ *          UCG_XMEGA_PRINT_LEN characters on the stack and drawn with one call of
+ *          <code>ucg_DrawString()</code>. See <code>ucg_vformat()</code> for the 
+ *          supported conversions.
  *
  *  \param  ucg      pointer to struct for the display
  *  \param  fmt      formatstring with escape sequences
@@ -250,15 +756,49 @@ static int ucg_Putc(char c, FILE *stream)
  */
 void ucg_Print(ucg_t *ucg, char *fmt, ...)
 {
-  va_list vl;
+  va_list      vl;
+  char         text[UCG_XMEGA_PRINT_LEN];
+  ucg_int_t    delta;
+  ucg_print_t *p = &((ucg_xmega_t *) ucg->xmega_hook)->print;
 
-  curr_ucg = ucg;
   va_start(vl, fmt);
-  vfprintf( ((ucg_print_t *) (curr_ucg->xmega_hook))->fp, fmt, vl);
+  ucg_vformat(text, sizeof(text), fmt, vl);
   va_end(vl);
+
+  delta = ucg_DrawString(ucg, p->tx, p->ty, p->tdir, text);
+
+  switch(p->tdir) {
+    case          0: p->tx += delta; break;
+    case          1: p->ty += delta; break;
+    case          2: p->tx -= delta; break;
+    default: case 3: p->ty -= delta; break;
+  }
+}
+
+/*! \brief  Sets the connection of a display: the interface, the pins and the DMA channel.
+ *
+ *          This function must be called before <code>ucg_Init()</code> or
+ *          <code>ucg_XmegaInitAsync()</code>: the HAL uses the hook of ucg_t as it is
+ *          and a struct ucg_t on the stack or the heap is not cleared.
+ *          NULL selects the connection of the macros of ucglib_xmega_hal.h. Each
+ *          other display needs its own struct, it also contains the state of the DMA
+ *          and the print facilities of the display. See ucglib_xmega_hal.h for an example.
+ *
+ *  \param  ucg      pointer to struct for the display
+ *  \param  xmega    pointer to the connection of the display, NULL for the macros
+ *
+ *  \return void
+ */
+void ucg_SetXmegaDisplay(ucg_t *ucg, ucg_xmega_t *xmega)
+{
+  if (xmega == NULL) xmega = &xmega_display;
+  ucg->xmega_hook = (void *) xmega;
 }
 
 /*! \brief  Initializes the printing facilities compatible with Arduino/C++ version of library
+ *
+ *          The print state is part of the connection of the display, so every display
+ *          has its own position and direction.
  *
  *  \param  ucg      pointer to struct for the display
  *
@@ -266,22 +806,170 @@ void ucg_Print(ucg_t *ucg, char *fmt, ...)
  */
 void ucg_PrintInit(ucg_t *ucg)
 {
-  if  (ucg->xmega_hook != NULL) return;
-  
-  ucg_print_t *p = (ucg_print_t *) malloc(sizeof(ucg_print_t));
-  
-  if (p == NULL) return;
-  
-  p->fp    = fdevopen(ucg_Putc, NULL); 
-  p->tx    = 0;
-  p->ty    = 0;
-  p->tdir  = 0;
-  
-  ucg->xmega_hook = (void *) p;
+  ucg_print_t *p = &((ucg_xmega_t *) ucg->xmega_hook)->print;
 
+  p->tx   = 0;
+  p->ty   = 0;
+  p->tdir = 0;
 }
+
 /////////////////////////////////////////////////
 
+#if UCG_XMEGA_STATS
+ucg_xmega_stat_t ucg_xmega_stat;    //!< counters of the communication
+
+/*! \brief  Counts a message of the communication callback
+ *
+ *  \param  msg      number of the message
+ *  \param  arg      argument of the message
+ *
+ *  \return void
+ */
+static void ucg_xmega_count(int16_t msg, uint16_t arg)
+{
+  uint8_t  i = msg - UCG_XMEGA_STAT_FIRST;
+  uint32_t n;
+
+  if (i >= UCG_XMEGA_STAT_CNT) return;
+
+  switch(msg) {
+    case UCG_COM_MSG_SEND_BYTE:             n = 1;                   break;
+    case UCG_COM_MSG_REPEAT_1_BYTE:         n = arg;                 break;
+    case UCG_COM_MSG_REPEAT_2_BYTES:        n = (uint32_t) arg * 2;  break;
+    case UCG_COM_MSG_REPEAT_3_BYTES:        n = (uint32_t) arg * 3;  break;
+    case UCG_COM_MSG_SEND_STR:              n = arg;                 break;
+    case UCG_COM_MSG_SEND_CD_DATA_SEQUENCE: n = arg;                 break;
+    case UCG_COM_MSG_CHANGE_CS_LINE:
+      if (arg == 0) {
+        ucg_xmega_stat.cs++;
+        ucg_xmega_stat.cs_frame++;
+      }
+      // no break
+    default:                                n = 0;                   break;
+  }
+  ucg_xmega_stat.calls[i]++;
+  ucg_xmega_stat.bytes[i] += n;
+}
+
+/*! \brief  Resets all counters of the communication
+ *
+ *  \return void
+ */
+void ucg_ClearXmegaStat(void)
+{
+  memset(&ucg_xmega_stat, 0, sizeof(ucg_xmega_stat));
+}
+
+/*! \brief  Marks the end of a frame, e.g. an iteration of the main loop.
+ *          The CS transactions since the previous call are the transactions of the frame.
+ *
+ *  \return void
+ */
+void ucg_XmegaStatFrame(void)
+{
+  ucg_xmega_stat.frames++;
+  ucg_xmega_stat.cs_frame_last = ucg_xmega_stat.cs_frame;
+  if (ucg_xmega_stat.cs_frame > ucg_xmega_stat.cs_frame_max) {
+    ucg_xmega_stat.cs_frame_max = ucg_xmega_stat.cs_frame;
+  }
+  ucg_xmega_stat.cs_frame = 0;
+}
+
+/*! \brief  Prints the counters of the communication with printf.
+ *          Use <code>init_stream()</code> of serialF0 to send them over the serial interface.
+ *
+ *  \return void
+ */
+void ucg_PrintXmegaStat(void)
+{
+  static const char *names[UCG_XMEGA_STAT_CNT] = {
+    "POWER_UP", "POWER_DOWN", "DELAY", "RESET_LINE", "CS_LINE", "CD_LINE",
+    "SEND_BYTE", "REPEAT_1", "REPEAT_2", "REPEAT_3", "SEND_STR", "CD_DATA_SEQ" };
+
+  printf("msg              calls       bytes\n");
+  for (uint8_t i=0; i<UCG_XMEGA_STAT_CNT; i++) {
+    if (ucg_xmega_stat.calls[i] == 0) continue;
+    printf("%-12s %9lu %11lu\n", names[i], ucg_xmega_stat.calls[i], ucg_xmega_stat.bytes[i]);
+  }
+  printf("CS transactions %lu, frames %lu, per frame last %lu max %lu\n",
+         ucg_xmega_stat.cs, ucg_xmega_stat.frames,
+         ucg_xmega_stat.cs_frame_last, ucg_xmega_stat.cs_frame_max);
+}
+#endif
+
+#if UCG_XMEGA_BENCH
+/*! \brief  Measures the throughput to the display and prints it with printf.
+ *
+ *          The display is filled with a box in four colors. Black and white only
+ *          clock SCK with bit banging through a virtual port, red and grey send every bit.
+ *          The time is measured with UCG_XMEGA_BENCH_TC and includes the overhead of
+ *          ucglib. Build the HAL with SPI, USART and bit banging to compare them.
+ *          Use <code>init_stream()</code> of serialF0 to send the results over the serial interface.
+ *
+ *          The figures below are estimates counted from the instructions at 32 MHz,
+ *          they have not been measured: no ATxmega with a display was available when
+ *          the bit banging through a virtual port was written. Replace them with the
+ *          output of this function.
+ * \verbatim
+            transport              per bit        bytes/s
+            SPI, DIV4               4 cycles      1000000  (8 MHz SCK)
+            BB, virtual port        6 cycles       600000  (red, grey)
+            BB, virtual port        2 cycles      2000000  (black, white, SCK only)
+            BB, PORT_t         15-20 cycles       230000
+   \endverbatim
+ *
+ *  \param  ucg      pointer to struct for the display
+ *
+ *  \return void
+ */
+void ucg_XmegaBench(ucg_t *ucg)
+{
+  static const uint8_t colors[4][3] = { {0, 0, 0}, {255, 255, 255}, {255, 0, 0}, {128, 128, 128} };
+  static const char *names[4] = { "black", "white", "red", "grey" };
+  ucg_int_t w = ucg_GetWidth(ucg);
+  ucg_int_t h = ucg_GetHeight(ucg);
+  uint32_t  bytes = (uint32_t) w * h * (UCG_COLOR_565 ? 2 : 3);
+  uint16_t  ticks;
+
+  UCG_XMEGA_BENCH_TC.CTRLA = TC_CLKSEL_OFF_gc;
+  UCG_XMEGA_BENCH_TC.CTRLB = TC_WGMODE_NORMAL_gc;
+  UCG_XMEGA_BENCH_TC.PER   = 0xFFFF;                     // at most 2.1 s
+
+  printf("fill       bytes      ms    bytes/s\n");
+  for (uint8_t i=0; i<4; i++) {
+    ucg_SetColor(ucg, 0, colors[i][0], colors[i][1], colors[i][2]);
+    UCG_XMEGA_BENCH_TC.CNT   = 0;
+    UCG_XMEGA_BENCH_TC.CTRLA = TC_CLKSEL_DIV1024_gc;     // 31250 Hz
+    ucg_DrawBox(ucg, 0, 0, w, h);
+    UCG_XMEGA_BENCH_TC.CTRLA = TC_CLKSEL_OFF_gc;
+    ticks = UCG_XMEGA_BENCH_TC.CNT;
+    if (ticks == 0) ticks = 1;
+    printf("%-6s %10lu %7lu %10lu\n", names[i], bytes,
+           (uint32_t) ticks * 1024 / (F_CPU / 1000), bytes * (F_CPU / 1024) / ticks);
+  }
+}
+#endif
+
+/*! \brief  Waits a number of microseconds
+ *
+ *          <code>_delay_loop_2()</code> takes 4 clock cycles per count, so the delay
+ *          does not grow with the overhead of a loop around <code>_delay_us(1)</code>.
+ *
+ *  \param  us       number of microseconds
+ *
+ *  \return void
+ */
+static void xmega_delay_us(uint16_t us)
+{
+  uint16_t n;
+
+  while (us > 0) {
+    n = us > 8000 ? 8000 : us;                // 8000 * 8 counts fit in 16 bits
+    _delay_loop_2(n * (uint16_t) (F_CPU / 4000000UL));
+    us -= n;
+  }
+}
+
 /*! \brief  The callback function for communication between the Xmega and the display.
  *
  *  \param  ucg      pointer to struct for the display
@@ -293,70 +981,72 @@ void ucg_PrintInit(ucg_t *ucg)
  */
 int16_t ucg_comm_xmega(ucg_t *ucg, int16_t msg, uint16_t arg, uint8_t *data)
 {
+  ucg_xmega_t *d = (ucg_xmega_t *) ucg->xmega_hook;
+
+  #if UCG_XMEGA_STATS
+    ucg_xmega_count(msg, arg);
+  #endif
+  #if UCG_XMEGA_DMA || (UCG_XMEGA_USE==UCG_XMEGA_USING_USART)
+    if (msg < UCG_COM_MSG_SEND_BYTE) {
+      #if UCG_XMEGA_DMA
+        xmega_dma_wait(d);   // lines and delays only after the last byte has been sent
+      #endif
+      #if UCG_XMEGA_USE==UCG_XMEGA_USING_USART
+        xmega_usart_flush(d);
+      #endif
+    }
+  #endif
+
   switch(msg)
   {
     case UCG_COM_MSG_POWER_UP:
-      xmega_init();
+      xmega_init(d);
       ucg_PrintInit(ucg);
       break;
     case UCG_COM_MSG_POWER_DOWN:
-      xmega_disable();
+      xmega_disable(d);
       break;
     case UCG_COM_MSG_DELAY:
-      for(uint16_t i=0; i<arg; i++) {
-        _delay_us(1);
-      }
+      xmega_delay_us(arg);
       break;
     case UCG_COM_MSG_CHANGE_RESET_LINE:
       if (arg) {
-        UCG_XMEGA_RESET_PORT.OUTSET = UCG_XMEGA_RESET_bm;
+        d->reset_port->OUTSET = d->reset_bm;
       } else {
-        UCG_XMEGA_RESET_PORT.OUTCLR = UCG_XMEGA_RESET_bm;
+        d->reset_port->OUTCLR = d->reset_bm;
       }
       break;
     case UCG_COM_MSG_CHANGE_CS_LINE:
       if (arg) {
-        UCG_XMEGA_CS_PORT.OUTSET = UCG_XMEGA_CS_bm;
+        d->cs_port->OUTSET = d->cs_bm;
       } else {
-        UCG_XMEGA_CS_PORT.OUTCLR = UCG_XMEGA_CS_bm;
+        d->cs_port->OUTCLR = d->cs_bm;
       }
       break;
     case UCG_COM_MSG_CHANGE_CD_LINE:
       if (arg) {
-        UCG_XMEGA_CD_PORT.OUTSET = UCG_XMEGA_CD_bm;
+        d->cd_port->OUTSET = d->cd_bm;
       } else {
-        UCG_XMEGA_CD_PORT.OUTCLR = UCG_XMEGA_CD_bm;
+        d->cd_port->OUTCLR = d->cd_bm;
       }
       break;
     case UCG_COM_MSG_SEND_BYTE:
-      xmega_transfer(arg);
+      xmega_transfer(d, arg);
       break;
     case UCG_COM_MSG_REPEAT_1_BYTE:
-      while( arg > 0 ) {
-        xmega_transfer(data[0]);
-        arg--;
-      }
+      xmega_transfer_repeat(d, data, 1, arg);
       break;
     case UCG_COM_MSG_REPEAT_2_BYTES:
-      while( arg > 0 ) {
-        xmega_transfer(data[0]);
-        xmega_transfer(data[1]);
-        arg--;
-      }
+      xmega_transfer_repeat(d, data, 2, arg);
       break;
     case UCG_COM_MSG_REPEAT_3_BYTES:
-      while( arg > 0 ) {
-        xmega_transfer(data[0]);
-        xmega_transfer(data[1]);
-        xmega_transfer(data[2]);
-        arg--;
-      }
+      xmega_transfer_repeat(d, data, 3, arg);
       break;
     case UCG_COM_MSG_SEND_STR:
-      while( arg > 0 ) {
-        xmega_transfer(*data++);
-        arg--;
-        }
+      xmega_transfer_str(d, data, arg);
+      break;
+    case UCG_COM_MSG_SEND_CD_DATA_SEQUENCE:
+      xmega_transfer_cd_seq(d, data, arg);
       break;
   }
   
@@ -364,3 +1054,112 @@ int16_t ucg_comm_xmega(ucg_t *ucg, int16_t msg, uint16_t arg, uint8_t *data)
 }
 
 /////////////////////////////////////////////////
+
+/*! \brief  Sets the end of a delay of the init sequence
+ *
+ *          UCG_XMEGA_INIT_TC counts at F_CPU/1024. Delays longer than 500 ms are
+ *          split, so the end can be compared with a signed difference.
+ *
+ *  \param  d        pointer to the connection of the display
+ *  \param  ms       delay in milliseconds
+ *
+ *  \return void
+ */
+static void xmega_init_wait(ucg_xmega_t *d, uint16_t ms)
+{
+  d->init_ms = 0;
+  if (ms > 500) {
+    d->init_ms = ms - 500;
+    ms = 500;
+  }
+  d->init_end = UCG_XMEGA_INIT_TC.CNT + 1 +
+                (uint16_t) (((uint32_t) ms * (F_CPU / 1024) + 999) / 1000);
+}
+
+/*! \brief  Initializes the display without waiting for the delays of the init sequence.
+ *
+ *          This replaces <code>ucg_Init()</code> with <code>ucg_comm_xmega()</code>.
+ *          The init sequence is sent up to its first delay, e.g. the reset pulse.
+ *          Call <code>ucg_XmegaInitPoll()</code> in the main loop until it returns 0
+ *          and draw nothing before. The main loop and interrupts are serviced while
+ *          the display is starting up.
+ * \verbatim
+            ucg_SetXmegaDisplay(&ucg, NULL);
+            ucg_XmegaInitAsync(&ucg, ucg_dev_st7735_18x128x160, ucg_ext_st7735_18);
+            while (1) {
+              if (ucg_XmegaInitPoll(&ucg) == 0) {
+                ... draw ...
+              }
+              ... other tasks ...
+            } \endverbatim
+ *          The delays are measured with UCG_XMEGA_INIT_TC, which is started once and
+ *          runs freely at F_CPU/1024 (32 us). More displays can be initialized at the same time.
+ *
+ *  \param  ucg        pointer to struct for the display
+ *  \param  device_cb  device callback, e.g. ucg_dev_st7735_18x128x160
+ *  \param  ext_cb     extension callback, e.g. ucg_ext_st7735_18
+ *
+ *  \return result of the power up of the display
+ */
+ucg_int_t ucg_XmegaInitAsync(ucg_t *ucg, ucg_dev_fnptr device_cb, ucg_dev_fnptr ext_cb)
+{
+  ucg_int_t r;
+
+  if (UCG_XMEGA_INIT_TC.CTRLA == TC_CLKSEL_OFF_gc) {
+    UCG_XMEGA_INIT_TC.CTRLB = TC_WGMODE_NORMAL_gc;
+    UCG_XMEGA_INIT_TC.PER   = 0xFFFF;
+    UCG_XMEGA_INIT_TC.CNT   = 0;
+    UCG_XMEGA_INIT_TC.INTFLAGS = TC0_OVFIF_bm;
+    UCG_XMEGA_INIT_TC.CTRLA = TC_CLKSEL_DIV1024_gc;
+  }
+
+  r = ucg_InitAsync(ucg, device_cb, ext_cb, (ucg_com_fnptr) ucg_comm_xmega);
+  if (ucg->cmd_seq_resume != NULL) {
+    xmega_init_wait((ucg_xmega_t *) ucg->xmega_hook, ucg->cmd_seq_delay);
+  }
+
+  return r;
+}
+
+/*! \brief  Continues the init sequence of the display if the current delay has passed.
+ *
+ *  \param  ucg      pointer to struct for the display
+ *
+ *  \return 1 if the display is starting up, 0 if it is ready
+ */
+uint8_t ucg_XmegaInitPoll(ucg_t *ucg)
+{
+  ucg_xmega_t *d = (ucg_xmega_t *) ucg->xmega_hook;
+
+  if (ucg->cmd_seq_resume == NULL) return 0;
+  if ((int16_t) (UCG_XMEGA_INIT_TC.CNT - d->init_end) < 0) return 1;
+
+  if (d->init_ms > 0) {
+    xmega_init_wait(d, d->init_ms);
+    return 1;
+  }
+  if (ucg_com_ResumeCmdSeq(ucg) == 0) return 0;
+  xmega_init_wait(d, ucg->cmd_seq_delay);
+
+  return 1;
+}
+
+/*! \brief  Returns the time since the first call of <code>ucg_XmegaInitAsync()</code>,
+ *          e.g. to measure the time from boot to the first frame.
+ *
+ *          The 16 bit counter of UCG_XMEGA_INIT_TC wraps after 2097 ms, its overflow
+ *          flag is not cleared after the start. The delays of the init sequence do not
+ *          depend on it, the time saturates.
+ *
+ *  \return time in milliseconds, UCG_XMEGA_INIT_TIME_OVF if more than 2097 ms have passed
+ */
+uint16_t ucg_XmegaInitTime(void)
+{
+  uint16_t cnt = UCG_XMEGA_INIT_TC.CNT;
+
+  if (UCG_XMEGA_INIT_TC.INTFLAGS & TC0_OVFIF_bm) return UCG_XMEGA_INIT_TIME_OVF;
+
+  return (uint32_t) cnt * 1024 / (F_CPU / 1000);
+}
+
+/////////////////////////////////////////////////
@@ -10,7 +10,7 @@
  *           <a href"https://github.com/olikraus/ucglib/wiki/hal">instructions</a> of Oli Kraus.
  *
  *           This file contains a callback function <code>ucg_com_xmega()</code> that handles the
- *           communication with the Xmega using SPI or bit banging.
+ *           communication with the Xmega using SPI, a USART in Master SPI mode or bit banging.
  *           The Arduino/C++ implementation of ucglib contains extra printing facilities.
  *           This file contains a bunch of functions that implements the same facilities.
  *           So you can use <code>ucg_SetPrintPos()</code>, <code>ucg_SetPrintDir()</code> 
@@ -25,26 +25,67 @@
              #endif
    \endverbatim
  *           or uses the ucg.h of the HAL package in stead
+ *
+ *           The hook points to a struct <code>ucg_xmega_t</code> with the connection of the
+ *           display, it must be set by <code>ucg_SetXmegaDisplay()</code> before
+ *           <code>ucg_Init()</code>. <code>ucg_SetXmegaDisplay(&ucg, NULL)</code> connects
+ *           the display as defined in the user specific part below. A second display on
+ *           another SPI interface gets its own struct and DMA channel:
+ * \verbatim
+             ucg_t       ucg2;
+             ucg_xmega_t ucg2_xmega = {
+               .spi        = &SPIC,
+               .sck_port   = &PORTC,  .sck_bm   = PIN7_bm,
+               .sda_port   = &PORTC,  .sda_bm   = PIN5_bm,
+               .cs_port    = &PORTC,  .cs_bm    = PIN4_bm,
+               .reset_port = &PORTC,  .reset_bm = PIN3_bm,
+               .cd_port    = &PORTC,  .cd_bm    = PIN2_bm,
+               .blk        = UCG_XMEGA_BLK_EXTERN,
+               .dma_ch     = &DMA.CH1, .dma_trigsrc = DMA_CH_TRIGSRC_SPIC_gc };
+
+             ucg_SetXmegaDisplay(&ucg2, &ucg2_xmega);
+             ucg_Init(&ucg2, ucg_dev_st7735_18x128x160, ucg_ext_st7735_18, ucg_comm_xmega);
+   \endverbatim
+ *           With DMA a transfer to one display continues while the other display is drawn.
+ *           The CS line is only changed after the last byte has been sent, so keep both
+ *           displays selected with <code>ucg_com_BeginBatch()</code> to refresh them
+ *           concurrently over several drawing calls.
  */
 #ifndef _UCGLIB_HAL_XMEGA_H
 #define _UCGLIB_HAL_XMEGA_H
 
+#include <avr/io.h>
 #include "csrc/ucg.h"
+#include "textslot.h"
 
 #define UCG_XMEGA_USING_SPI       0    //!<  value defining SPI is used
 #define UCG_XMEGA_USING_BB        1    //!<  value defining bit banging is used
+#define UCG_XMEGA_USING_USART     2    //!<  value defining a USART in Master SPI mode is used
 
 #define UCG_XMEGA_BLK_CONNECT     0    //!<  value defining BLK/LED is connected to Xmega
 #define UCG_XMEGA_BLK_EXTERN      1    //!<  value defining BLK/LED is not connected with Xmega
 #define UCG_XMEGA_BLK_DISABLED    2    //!<  value defining BLK/LED is connected with Xmega, but pin is disabled 
 
 // start user specific part
-#define UCG_XMEGA_USE             UCG_XMEGA_USING_SPI    //!<  defining the use of SPI or bit banging 
+#define UCG_XMEGA_USE             UCG_XMEGA_USING_SPI    //!<  defining the use of SPI, bit banging or a USART in Master SPI mode
 #define UCG_XMEGA_BLK             UCG_XMEGA_BLK_CONNECT  //!<  defining the status of the BLK or LED connection
 
 #define UCG_XMEGA_INTERFACE       SPID                  //!<  SPI interface used
 #define UCG_XMEGA_SPI_PORT        PORTD                 //!<  port SPI interface using SPI
 #define UCG_XMEGA_BB_PORT         PORTD                 //!<  port SPI interface using BB
+#define UCG_XMEGA_SPI_PRESCALER   SPI_PRESCALER_DIV4_gc //!<  prescaler of the SPI interface
+#define UCG_XMEGA_SPI_CLK2X       0                     //!<  1: double clock speed, see below
+
+// USARTD1 sends with XCK on PD5 and TXD on PD7: SCK and SDA are swapped compared with SPID
+#define UCG_XMEGA_USART           USARTD1               //!<  USART used in Master SPI mode, CS, RESET, CD and BLK are the pins of SPI
+#define UCG_XMEGA_USART_PORT      PORTD                 //!<  port of XCK and TXD of the USART
+#define UCG_XMEGA_USART_XCK_bp    PIN5_bp               //!<  pin position of XCK, the SCK connection using USART
+#define UCG_XMEGA_USART_TXD_bp    PIN7_bp               //!<  pin position of TXD, the SDA or MOSI connection using USART
+#define UCG_XMEGA_USART_BSEL      1                     //!<  clock is F_CPU / (2*(BSEL+1)), 1: 8 MHz
+
+// The serial clock of the ST7735 is specified up to about 15 MHz for writing, the default is 8 MHz
+// (DIV4 or BSEL 1). UCG_XMEGA_SPI_CLK2X 1 or UCG_XMEGA_USART_BSEL 0 give 16 MHz, an overclock
+// that works with many displays, but not with all of them and not at all wire lengths.
 
 #define UCG_XMEGA_SPI_SCK_PORT    UCG_XMEGA_SPI_PORT    //!<  port SCK connection using SPI
 #define UCG_XMEGA_SPI_MOSI_PORT   UCG_XMEGA_SPI_PORT    //!<  port SDA or MOSI connection using SPI
@@ -75,13 +116,113 @@
 #define UCG_XMEGA_BB_RESET_bp     PIN1_bp      //!<  pin position of RESET connection using BB
 #define UCG_XMEGA_BB_CD_bp        PIN2_bp      //!<  pin position of CD or DC or AO connection using BB
 #define UCG_XMEGA_BB_BLK_bp       PIN5_bp      //!<  pin position of BLK or LED connection using BB (optional)
+
+#define UCG_XMEGA_BB_VPORT        1            //!<  1: SCK and SDA using BB are written by single cycle instructions through a virtual port
+#define UCG_XMEGA_BB_VPORT_NUM    3            //!<  virtual port 0..3 that is mapped to the port of SCK and SDA using BB
+
+#define UCG_XMEGA_PRINT_LEN       32           //!<  maximum length of the string of ucg_Print(), including '\0'
+
+#define UCG_XMEGA_STATS           0            //!<  1: count calls and bytes of the communication messages
+
+#define UCG_XMEGA_DMA             0            //!<  1: send strings and repeated bytes with DMA (only using SPI or USART)
+#define UCG_XMEGA_DMA_CH          DMA.CH0      //!<  DMA channel used for the display
+#if UCG_XMEGA_USE==UCG_XMEGA_USING_USART
+#define UCG_XMEGA_DMA_TRIGSRC     DMA_CH_TRIGSRC_USARTD1_DRE_gc  //!<  DMA trigger of the USART: data register empty
+#else
+#define UCG_XMEGA_DMA_TRIGSRC     DMA_CH_TRIGSRC_SPID_gc  //!<  DMA trigger of the SPI interface
+#endif
+#define UCG_XMEGA_DMA_BUF_SIZE    24           //!<  size of each of the two DMA buffers, multiple of 2 and 3
+#define UCG_XMEGA_DMA_MIN         4            //!<  less bytes are sent without DMA
+
+#define UCG_XMEGA_BENCH           0            //!<  1: add ucg_XmegaBench() that measures the throughput to the display
+#define UCG_XMEGA_BENCH_TC        TCC1         //!<  timer/counter used by ucg_XmegaBench()
+
+#define UCG_XMEGA_INIT_TC         TCC0         //!<  free running timer/counter for the delays of ucg_XmegaInitAsync(), not UCG_XMEGA_BENCH_TC
 // end user specific part
 
+/*!
+ * Struct for compatibility printing facilities with Arduino/C++ version of library 
+ */
+typedef struct {      
+  ucg_int_t  tx;      //!< current x coordinate of the position
+  ucg_int_t  ty;      //!< current y coordinate of the position
+  uint8_t    tdir;    //!< current printing direction
+} ucg_print_t;           
+
+/*!
+ * Struct for the connection of a display: the interface, the pins, the DMA channel and
+ * the state of the DMA and the print facilities. The struct is passed to the callback
+ * by the hook in ucg_t, see ucg_SetXmegaDisplay().
+ */
+typedef struct {
+  SPI_t         *spi;                        //!< SPI interface, only using SPI
+  USART_t       *usart;                      //!< USART in Master SPI mode, only using USART
+  uint8_t        usart_busy;                 //!< 1 if the USART may still be sending
+  PORT_t        *sck_port;                   //!< port of SCK
+  uint8_t        sck_bm;                     //!< pin mask of SCK
+  PORT_t        *sda_port;                   //!< port of SDA or MOSI
+  uint8_t        sda_bm;                     //!< pin mask of SDA or MOSI
+  PORT_t        *cs_port;                    //!< port of CS or SS
+  uint8_t        cs_bm;                      //!< pin mask of CS or SS
+  PORT_t        *reset_port;                 //!< port of RESET
+  uint8_t        reset_bm;                   //!< pin mask of RESET
+  PORT_t        *cd_port;                    //!< port of CD or DC or AO
+  uint8_t        cd_bm;                      //!< pin mask of CD or DC or AO
+  PORT_t        *blk_port;                   //!< port of BLK or LED (optional)
+  uint8_t        blk_bp;                     //!< pin position of BLK or LED (optional)
+  uint8_t        blk;                        //!< UCG_XMEGA_BLK_CONNECT, UCG_XMEGA_BLK_EXTERN or UCG_XMEGA_BLK_DISABLED
+#if UCG_XMEGA_DMA
+  DMA_CH_t      *dma_ch;                     //!< DMA channel, every display needs its own channel
+  uint8_t        dma_trigsrc;                //!< DMA trigger of the SPI interface or the USART
+  uint8_t        dma_buf[2][UCG_XMEGA_DMA_BUF_SIZE];  //!< buffers for the DMA, one is sent while the other is filled
+  uint8_t        dma_next;                   //!< index of the buffer that is filled next
+  uint8_t        dma_busy;                   //!< 1 if a DMA transfer has been started
+#endif
+  uint16_t       init_end;                   //!< count of UCG_XMEGA_INIT_TC at the end of a delay of the init sequence
+  uint16_t       init_ms;                    //!< milliseconds of the delay that remain after init_end
+  ucg_print_t    print;                      //!< state of the print facilities
+} ucg_xmega_t;
+
 int16_t ucg_comm_xmega(ucg_t *ucg, int16_t msg, uint16_t arg, uint8_t *data);
+void  ucg_SetXmegaDisplay(ucg_t *ucg, ucg_xmega_t *xmega);
+
+ucg_int_t ucg_XmegaInitAsync(ucg_t *ucg, ucg_dev_fnptr device_cb, ucg_dev_fnptr ext_cb);
+uint8_t   ucg_XmegaInitPoll(ucg_t *ucg);
+uint16_t  ucg_XmegaInitTime(void);
+
+#define UCG_XMEGA_INIT_TIME_OVF   0xFFFF       //!<  ucg_XmegaInitTime(): more than 2097 ms have passed
 
 void  ucg_PrintInit(ucg_t *ucg);
 void  ucg_SetPrintPos(ucg_t *ucg, ucg_int_t x, ucg_int_t y);
 void  ucg_SetPrintDir(ucg_t *ucg, uint8_t dir);
 void  ucg_Print(ucg_t *ucg, char *fmt, ...);
 void  ucg_GetPrintPos(ucg_t *ucg, ucg_int_t *x, ucg_int_t *y);
+
+#if UCG_XMEGA_STATS
+#define UCG_XMEGA_STAT_FIRST      UCG_COM_MSG_POWER_UP                 //!<  first counted message
+#define UCG_XMEGA_STAT_CNT        (UCG_COM_MSG_SEND_CD_DATA_SEQUENCE-UCG_COM_MSG_POWER_UP+1)  //!<  number of counted messages
+
+/*!
+ * Struct with the counters of the communication, only if UCG_XMEGA_STATS is 1
+ */
+typedef struct {
+  uint32_t calls[UCG_XMEGA_STAT_CNT];   //!< number of calls per message
+  uint32_t bytes[UCG_XMEGA_STAT_CNT];   //!< number of bytes sent per message
+  uint32_t cs;                          //!< number of CS transactions (CS low)
+  uint32_t frames;                      //!< number of frames, see ucg_XmegaStatFrame()
+  uint32_t cs_frame;                    //!< CS transactions of the current frame
+  uint32_t cs_frame_last;               //!< CS transactions of the last frame
+  uint32_t cs_frame_max;                //!< maximum of CS transactions of a frame
+} ucg_xmega_stat_t;
+
+extern ucg_xmega_stat_t ucg_xmega_stat;
+
+void  ucg_ClearXmegaStat(void);
+void  ucg_XmegaStatFrame(void);
+void  ucg_PrintXmegaStat(void);
+#endif
+
+#if UCG_XMEGA_BENCH
+void  ucg_XmegaBench(ucg_t *ucg);
+#endif
 #endif
\ No newline at end of file